@@ -0,0 +1,39 @@
+#include <signals/connection.hpp>
+#include <signals/shared_connection_block.hpp>
+#include <signals/signal.hpp>
+
+#include <benchmark/benchmark.h>
+
+using sig::Shared_connection_block;
+using sig::Signal;
+
+// Create and destroy a block on a single connection.
+void BM_shared_connection_block_churn(benchmark::State& state)
+{
+    auto s       = Signal<void()>{};
+    auto const c = s.connect([] {});
+    for (auto _ : state) {
+        auto const block = Shared_connection_block{c};
+        benchmark::DoNotOptimize(block.blocking());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_shared_connection_block_churn);
+
+// Toggle an existing block while the Signal is emitted.
+void BM_shared_connection_block_emit(benchmark::State& state)
+{
+    auto total   = 0;
+    auto s       = Signal<void()>{};
+    auto const c = s.connect([&total] { ++total; });
+    auto block   = Shared_connection_block{c, false};
+    for (auto _ : state) {
+        block.block();
+        s();
+        block.unblock();
+        s();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_shared_connection_block_emit);
@@ -0,0 +1,342 @@
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <signals/batch_order.hpp>
+#include <signals/connection.hpp>
+#include <signals/connection_handle.hpp>
+#include <signals/inplace_function.hpp>
+#include <signals/position.hpp>
+#include <signals/signal.hpp>
+#include <signals/slot.hpp>
+#include <signals/static_signal.hpp>
+#include <signals/threading.hpp>
+
+#include <benchmark/benchmark.h>
+
+using sig::Batch_order;
+using sig::Connection;
+using sig::Inplace_function;
+using sig::Null_mutex;
+using sig::Optional_last_value;
+using sig::Position;
+using sig::Signal;
+using sig::Slot;
+using sig::make_static_signal;
+
+namespace {
+
+// Slot counts used by every emission benchmark.
+void slot_counts(benchmark::internal::Benchmark* b)
+{
+    for (auto n : {0, 1, 10, 1'000})
+        b->Arg(n);
+}
+
+// Reports emissions and Slot calls per second, for \p emits_per_iteration
+// emissions in each iteration.
+void set_counters(benchmark::State& state, int emits_per_iteration = 1)
+{
+    auto const slots = static_cast<double>(state.range(0));
+    auto const emits =
+        static_cast<double>(state.iterations()) * emits_per_iteration;
+    state.counters["emits"] =
+        benchmark::Counter(emits, benchmark::Counter::kIsRate);
+    state.counters["slot_calls"] =
+        benchmark::Counter(emits * slots, benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+// Baseline: a plain loop over std::function objects.
+void BM_std_function_vector(benchmark::State& state)
+{
+    auto total = 0;
+    auto slots = std::vector<std::function<void(int)>>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        slots.push_back([&total](int x) { total += x; });
+    for (auto _ : state) {
+        for (auto const& slot : slots)
+            slot(1);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_std_function_vector)->Apply(slot_counts);
+
+void BM_emit(benchmark::State& state)
+{
+    auto total = 0;
+    auto s     = Signal<void(int)>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        s.connect([&total](int x) { total += x; });
+    for (auto _ : state) {
+        s(1);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_emit)->Apply(slot_counts);
+
+void BM_emit_result(benchmark::State& state)
+{
+    auto s = Signal<int(int)>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        s.connect([i](int x) { return x + i; });
+    for (auto _ : state)
+        benchmark::DoNotOptimize(s(1));
+    set_counters(state);
+}
+BENCHMARK(BM_emit_result)->Apply(slot_counts);
+
+// One Signal emitted from several threads at once, every emission reads the
+// same published snapshot.
+void BM_emit_shared(benchmark::State& state)
+{
+    static auto const s = [slots = state.range(0)] {
+        auto signal = Signal<int(int)>{};
+        for (auto i = 0; i < slots; ++i)
+            signal.connect([i](int x) { return x + i; });
+        return signal;
+    }();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(s(1));
+    set_counters(state);
+}
+BENCHMARK(BM_emit_shared)->Arg(10)->Threads(1)->Threads(4);
+
+// A Slot connecting and disconnecting another Slot during every emission.
+void BM_emit_reentrant_connect(benchmark::State& state)
+{
+    auto total = 0;
+    auto s     = Signal<void(int)>{};
+    s.connect([&s](int) { s.connect([](int) {}).disconnect(); });
+    for (auto i = 1; i < state.range(0); ++i)
+        s.connect([&total](int x) { total += x; });
+    for (auto _ : state) {
+        s(1);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_emit_reentrant_connect)->Arg(1)->Arg(10)->Arg(1'000);
+
+// A payload each Slot takes by value, copied into every Slot by operator().
+void BM_emit_vector_payload(benchmark::State& state)
+{
+    auto total = std::size_t{0};
+    auto s     = Signal<void(std::vector<int>)>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        s.connect([&total](std::vector<int> v) { total += v.size(); });
+    for (auto _ : state) {
+        s(std::vector<int>(1'024));
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_emit_vector_payload)->Apply(slot_counts);
+
+// The same payload moved into the last Slot.
+void BM_emit_forward_vector_payload(benchmark::State& state)
+{
+    auto total = std::size_t{0};
+    auto s     = Signal<void(std::vector<int>)>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        s.connect([&total](std::vector<int> v) { total += v.size(); });
+    for (auto _ : state) {
+        s.emit_forward(std::vector<int>(1'024));
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_emit_forward_vector_payload)->Apply(slot_counts);
+
+void BM_emit_grouped(benchmark::State& state)
+{
+    auto total = 0;
+    auto s     = Signal<void(int)>{};
+    for (auto i = 0; i < state.range(0); ++i) {
+        auto const pos = i % 2 == 0 ? Position::at_back : Position::at_front;
+        s.connect(i % 10, [&total](int x) { total += x; }, pos);
+    }
+    for (auto _ : state) {
+        s(1);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_emit_grouped)->Apply(slot_counts);
+
+void BM_emit_tracked(benchmark::State& state)
+{
+    auto total   = 0;
+    auto tracked = std::make_shared<int>(0);
+    auto s       = Signal<void(int)>{};
+    for (auto i = 0; i < state.range(0); ++i) {
+        auto slot = Slot<void(int)>{[&total](int x) { total += x; }};
+        s.connect(slot.track(tracked));
+    }
+    for (auto _ : state) {
+        s(1);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_emit_tracked)->Apply(slot_counts);
+
+void BM_emit_extended(benchmark::State& state)
+{
+    auto total = 0;
+    auto s     = Signal<void(int)>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        s.connect_extended([&total](Connection const&, int x) { total += x; });
+    for (auto _ : state) {
+        s(1);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_emit_extended)->Apply(slot_counts);
+
+void BM_emit_inplace_function(benchmark::State& state)
+{
+    using Function = Inplace_function<void(int)>;
+    auto total     = 0;
+    auto s = Signal<void(int), Optional_last_value<void>, int, std::less<int>,
+                    Function>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        s.connect([&total](int x) { total += x; });
+    for (auto _ : state) {
+        s(1);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_emit_inplace_function)->Apply(slot_counts);
+
+void BM_emit_single_threaded(benchmark::State& state)
+{
+    auto total = 0;
+    auto s = Signal<void(int), Optional_last_value<void>, int, std::less<int>,
+                    std::function<void(int)>, Null_mutex>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        s.connect([&total](int x) { total += x; });
+    for (auto _ : state) {
+        s(1);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_emit_single_threaded)->Apply(slot_counts);
+
+// Ten Slots fixed at compile time, compare with BM_emit/10.
+void BM_static_signal(benchmark::State& state)
+{
+    auto total      = 0;
+    auto const slot = [&total](int x) { total += x; };
+    auto s = make_static_signal<void(int)>(slot, slot, slot, slot, slot, slot,
+                                           slot, slot, slot, slot);
+    for (auto _ : state) {
+        s(1);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state);
+}
+BENCHMARK(BM_static_signal)->Arg(10);
+
+// A batch of 64 emissions per iteration, state.range(1) selects slot_major.
+void BM_emit_batch(benchmark::State& state)
+{
+    constexpr auto batch_size = 64;
+    auto total                = 0;
+    auto s                    = Signal<void(int)>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        s.connect([&total](int x) { total += x; });
+    auto const batch = std::vector<std::tuple<int>>(batch_size, {1});
+    auto const order = state.range(1) == 0 ? Batch_order::emission_major
+                                           : Batch_order::slot_major;
+    for (auto _ : state) {
+        s.emit_batch(batch, order);
+        benchmark::DoNotOptimize(total);
+    }
+    set_counters(state, batch_size);
+}
+BENCHMARK(BM_emit_batch)
+    ->Args({1, 0})
+    ->Args({1, 1})
+    ->Args({10, 0})
+    ->Args({10, 1})
+    ->Args({1'000, 0})
+    ->Args({1'000, 1});
+
+// Connect then disconnect through the Connection, on a Signal that already
+// holds state.range(0) Slots.
+void BM_connect_disconnect(benchmark::State& state)
+{
+    auto s = Signal<void(int)>{};
+    for (auto i = 0; i < state.range(0); ++i)
+        s.connect([](int) {});
+    for (auto _ : state) {
+        auto const c = s.connect([](int) {});
+        c.disconnect();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_connect_disconnect)->Apply(slot_counts);
+
+// Connect state.range(0) Slots to a fresh Signal, then disconnect all of them.
+void BM_connect_all_disconnect_all(benchmark::State& state)
+{
+    auto const n = static_cast<std::size_t>(state.range(0));
+    auto handles = std::vector<Connection>{};
+    handles.reserve(n);
+    for (auto _ : state) {
+        auto s = Signal<void(int)>{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+            handles.push_back(s.connect([](int) {}));
+        for (auto const& c : handles)
+            c.disconnect();
+        handles.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_connect_all_disconnect_all)->Arg(10)->Arg(1'000);
+
+// BM_connect_all_disconnect_all with one connect_range and one disconnect.
+void BM_connect_range_disconnect_range(benchmark::State& state)
+{
+    auto const n = static_cast<std::size_t>(state.range(0));
+    auto const slots =
+        std::vector<std::function<void(int)>>(n, [](int) {});
+    for (auto _ : state) {
+        auto s             = Signal<void(int)>{};
+        auto const handles = s.connect_range(slots);
+        s.disconnect(handles);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_connect_range_disconnect_range)->Arg(10)->Arg(1'000);
+
+// Query through the weak_ptr of a Connection.
+void BM_connection_connected(benchmark::State& state)
+{
+    auto s       = Signal<void(int)>{};
+    auto const c = s.connect([](int) {});
+    for (auto _ : state)
+        benchmark::DoNotOptimize(c.connected());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_connection_connected);
+
+// Same query through a Connection_handle, compare with the one above.
+void BM_connection_handle_connected(benchmark::State& state)
+{
+    auto s       = Signal<void(int)>{};
+    auto const h = s.connect([](int) {}).handle();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(h.connected());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_connection_handle_connected);
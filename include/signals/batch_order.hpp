@@ -0,0 +1,12 @@
+#ifndef SIGNALS_BATCH_ORDER_HPP
+#define SIGNALS_BATCH_ORDER_HPP
+namespace sig {
+
+/// Identifies the order Slots are called in by Signal::emit_batch.
+/** emission_major completes each emission before starting the next, as
+ *  repeated calls would. slot_major calls each Slot for every emission in the
+ *  batch before moving to the next Slot. */
+enum class Batch_order { emission_major, slot_major };
+
+}  // namespace sig
+#endif  // SIGNALS_BATCH_ORDER_HPP
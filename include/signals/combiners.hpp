@@ -0,0 +1,286 @@
+/// \file
+/// Combiners that stop calling Slots once the result is known.
+#ifndef SIGNALS_COMBINERS_HPP
+#define SIGNALS_COMBINERS_HPP
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace sig {
+
+// Each Slot is called when its iterator is dereferenced, so a Combiner that
+// returns before reaching last never calls the remaining Slots.
+
+/// Returns the result of the first Slot, without calling any other Slot.
+template <typename T>
+class Optional_first_value {
+   public:
+    /// Type of object the iterator range points to.
+    using Result_type = std::optional<T>;
+
+   public:
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       The value of the first iterator of the range, or an
+    ///                empty std::optional if the range is empty.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        if (first == last)
+            return {std::nullopt};
+        return {*first};
+    }
+};
+
+/// Returns the first Slot result that converts to true.
+/** Meant for lookups where each Slot returns a std::optional, a pointer or a
+ *  smart pointer. Slots after the first non-empty result are not called. */
+template <typename T>
+class First_non_empty {
+   public:
+    /// Type of object the iterator range points to.
+    using Result_type = T;
+
+   public:
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       The first value that converts to true, or a value
+    ///                initialized T if there is none.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        for (; first != last; ++first) {
+            auto value = T(*first);
+            if (value)
+                return value;
+        }
+        return T();
+    }
+};
+
+/// Calls Slots until one returns false.
+/** Lets any Slot veto an action, the Slots after the veto are not called. */
+class Until_false {
+   public:
+    /// Type of object the iterator range points to.
+    using Result_type = bool;
+
+   public:
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       false if a Slot returned false, true otherwise, also
+    ///                when the range is empty.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        for (; first != last; ++first) {
+            if (!static_cast<bool>(*first))
+                return false;
+        }
+        return true;
+    }
+};
+
+/// Calls Slots until one returns true.
+/** Lets the first Slot that handles an event stop it from reaching the Slots
+ *  after it. */
+class Until_true {
+   public:
+    /// Type of object the iterator range points to.
+    using Result_type = bool;
+
+   public:
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       true if a Slot returned true, false otherwise, also when
+    ///                the range is empty.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        for (; first != last; ++first) {
+            if (static_cast<bool>(*first))
+                return true;
+        }
+        return false;
+    }
+};
+
+/// Returns the least of the Slot results.
+/** Every Slot is called. Of equal results, the first is kept. */
+template <typename T, typename Compare = std::less<T>>
+class Optional_min {
+   public:
+    /// Type of object the iterator range points to.
+    using Result_type = std::optional<T>;
+
+   public:
+    /// \param compare Strict weak ordering of T.
+    explicit Optional_min(Compare compare = Compare())
+        : compare_{std::move(compare)}
+    {}
+
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       The least value, or an empty std::optional if the range
+    ///                is empty.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        if (first == last)
+            return {std::nullopt};
+        auto result = Result_type{*first};
+        for (++first; first != last; ++first) {
+            auto value = T(*first);
+            if (compare_(value, *result))
+                *result = std::move(value);
+        }
+        return result;
+    }
+
+   private:
+    Compare compare_;
+};
+
+/// Returns the greatest of the Slot results.
+/** Every Slot is called. Of equal results, the first is kept. */
+template <typename T, typename Compare = std::less<T>>
+class Optional_max {
+   public:
+    /// Type of object the iterator range points to.
+    using Result_type = std::optional<T>;
+
+   public:
+    /// \param compare Strict weak ordering of T.
+    explicit Optional_max(Compare compare = Compare())
+        : compare_{std::move(compare)}
+    {}
+
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       The greatest value, or an empty std::optional if the
+    ///                range is empty.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        if (first == last)
+            return {std::nullopt};
+        auto result = Result_type{*first};
+        for (++first; first != last; ++first) {
+            auto value = T(*first);
+            if (compare_(*result, value))
+                *result = std::move(value);
+        }
+        return result;
+    }
+
+   private:
+    Compare compare_;
+};
+
+/// Returns the sum of the Slot results.
+/** Every Slot is called. The sum starts from the first result, so T needs no
+ *  zero value and may be any type with operator+=, such as std::string. */
+template <typename T>
+class Optional_sum {
+   public:
+    /// Type of object the iterator range points to.
+    using Result_type = std::optional<T>;
+
+   public:
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       The sum of the values, or an empty std::optional if the
+    ///                range is empty.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        if (first == last)
+            return {std::nullopt};
+        auto result = Result_type{*first};
+        for (++first; first != last; ++first)
+            *result += *first;
+        return result;
+    }
+};
+
+/// Returns the Slot results in call order, up to a maximum count.
+/** Slots after the maximum is reached are not called. */
+template <typename T>
+class Vector_collector {
+   public:
+    /// Type of object the iterator range points to.
+    using Result_type = std::vector<T>;
+
+   public:
+    /// \param max_count Number of results after which no Slot is called.
+    explicit Vector_collector(
+        std::size_t max_count = std::numeric_limits<std::size_t>::max())
+        : max_count_{max_count}
+    {}
+
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       The values of the range, at most max_count of them.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        auto results = Result_type{};
+        for (; first != last && results.size() < max_count_; ++first)
+            results.push_back(*first);
+        return results;
+    }
+
+   private:
+    std::size_t max_count_;
+};
+
+/// Writes the Slot results in call order to a buffer owned by the caller.
+/** Nothing is allocated per emission. Slots after the buffer is full are not
+ *  called. Each emission writes from the start of the buffer, so emissions of
+ *  a Signal using this Combiner must not run concurrently. */
+template <typename T>
+class Buffer_collector {
+   public:
+    /// Type of object the iterator range points to, the number of results
+    /// written.
+    using Result_type = std::size_t;
+
+   public:
+    /// Constructs a Combiner with no room, which calls no Slot.
+    Buffer_collector() = default;
+
+    /// \param data First element of the buffer, must outlive the emissions.
+    /// \param size Number of elements in the buffer.
+    Buffer_collector(T* data, std::size_t size) : data_{data}, size_{size} {}
+
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       The number of values written to the buffer.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        auto count = std::size_t{0};
+        for (; first != last && count < size_; ++first)
+            data_[count++] = *first;
+        return count;
+    }
+
+   private:
+    T* data_          = nullptr;
+    std::size_t size_ = 0;
+};
+
+}  // namespace sig
+#endif  // SIGNALS_COMBINERS_HPP
@@ -3,13 +3,19 @@
 #include <memory>
 #include <utility>
 
+#include "connection_handle.hpp"
 #include "detail/connection_impl_base.hpp"
 
 namespace sig {
 
 /// Represents the connection made when a Slot is connected to a Signal.
 /** Can be queried to check if the Slot is still connected to the Signal. The
- *  Connection can be blocked by constructing a Shared_connection_block. */
+ *  Connection can be blocked by constructing a Shared_connection_block.
+ *  Queries and disconnect() go through the connection's Connection_handle, so
+ *  they follow the threading policy of the Signal. Comparisons and copies use
+ *  a weak_ptr to the connection, copying or destroying a Connection adjusts
+ *  its weak count atomically whatever the policy, code that copies
+ *  connections in bulk can store Connection_handles instead. */
 class Connection {
    public:
     /// Default constructors a connection that refers to no real connection.
@@ -23,36 +29,54 @@ class Connection {
      *  \sa Signal Slot */
     explicit Connection(std::weak_ptr<Connection_impl_base> wp_cib)
         : pimpl_{std::move(wp_cib)}
+    {
+        if (auto const impl = pimpl_.lock())
+            handle_ = impl->handle();
+    }
+
+    Connection(Connection const&) = default;
+
+    /// Leaves \p other referring to no connection.
+    Connection(Connection&& other) noexcept
+        : pimpl_{std::move(other.pimpl_)},
+          handle_{std::exchange(other.handle_, {})}
     {}
 
+    auto operator=(Connection const&) -> Connection& = default;
+
+    /// Leaves \p other referring to no connection.
+    auto operator=(Connection&& other) noexcept -> Connection&
+    {
+        pimpl_  = std::move(other.pimpl_);
+        handle_ = std::exchange(other.handle_, {});
+        return *this;
+    }
+
+    ~Connection() = default;
+
     /// Disconnects the connection.
     /** The Slot associated with this connection will no longer be called by the
      *  associated Signal. If connection is already disconnected, this is a
      *  no-op. */
-    void disconnect() const
-    {
-        if (!this->pimpl_.expired())
-            pimpl_.lock()->disconnect();
-    }
+    void disconnect() const { handle_.disconnect(); }
 
     /// Query whether the connection is connected or not.
     /** \returns True if *this is connected, false otherwise. */
-    auto connected() const -> bool
-    {
-        if (!this->pimpl_.expired())
-            return pimpl_.lock()->connected();
-        return false;
-    }
+    auto connected() const -> bool { return handle_.connected(); }
 
     /// Query whether the connection is currently blocked or not.
     /** Blocking can happen from initializing a Shared_connection_block with
      *  *this.
      *  \returns True if the connection is blocked, false otherwise. */
-    auto blocked() const -> bool
+    auto blocked() const -> bool { return handle_.blocked(); }
+
+    /// Access a lightweight handle to the same connection.
+    /** \returns A Connection_handle to the connection, or one referring to no
+     *  connection if *this does not refer to a live connection.
+     *  \sa Connection_handle */
+    auto handle() const -> Connection_handle
     {
-        if (!this->pimpl_.expired())
-            return pimpl_.lock()->blocked();
-        return false;
+        return handle_.alive() ? handle_ : Connection_handle{};
     }
 
     /// Return true if both parameters refer to the same Signal/Slot connection.
@@ -71,6 +95,7 @@ class Connection {
 
    private:
     std::weak_ptr<Connection_impl_base> pimpl_;
+    Connection_handle handle_;
 };
 
 /// Returns !(*this == x)
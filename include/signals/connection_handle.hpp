@@ -0,0 +1,149 @@
+/// \file
+/// Trivially copyable reference to a connection, by table, index and
+/// generation.
+#ifndef SIGNALS_CONNECTION_HANDLE_HPP
+#define SIGNALS_CONNECTION_HANDLE_HPP
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "detail/connection_table.hpp"
+
+namespace sig {
+class Connection;
+class Shared_connection_block;
+
+/// Refers to a Signal/Slot connection without sharing ownership of it.
+/** A Connection_handle is a pointer to the connection table of a Signal, an
+ *  index into it and the generation of the entry at the time the handle was
+ *  made. An entry's generation changes when its connection is destroyed, and
+ *  tables are recycled rather than freed, so queries and disconnect() need no
+ *  reference count traffic and are safe at any time, also after the Signal is
+ *  gone. Handles to connections of single-threaded Signals compare the
+ *  generation and update the connection with a plain load and store, like the
+ *  Signal itself. For multi-threaded Signals the handle pins the entry for
+ *  the duration of the operation.
+ *  Handles are trivially copyable, hashable, and cheap to store in bulk. A
+ *  generation is 32 bits, a handle kept while its entry is reused 2^32 times
+ *  would match again.
+ *  \sa Connection::handle */
+class Connection_handle {
+   public:
+    /// Default constructs a handle that refers to no connection.
+    Connection_handle() = default;
+
+    /// Constructor used by Connection::handle().
+    /** \param table Connection table of the Signal.
+     *  \param index Entry in the connection table.
+     *  \param generation Generation of the entry owned by the connection. */
+    Connection_handle(Connection_table_base const& table,
+                      std::uint32_t index,
+                      std::uint32_t generation)
+        : table_{&table}, index_{index}, generation_{generation}
+    {}
+
+   public:
+    /// Disconnects the connection, no-op if it is already disconnected.
+    void disconnect() const
+    {
+        this->update(Connection_table_base::Update::disconnect);
+    }
+
+    /// Query whether the connection is connected or not.
+    auto connected() const -> bool
+    {
+        auto const state = this->state();
+        return state != absent && (state & connected_bit) != 0;
+    }
+
+    /// Query whether the connection is currently blocked or not.
+    auto blocked() const -> bool
+    {
+        auto const state = this->state();
+        return state != absent && (state & ~connected_bit) != 0;
+    }
+
+    /// \returns The index of the connection's table entry.
+    auto index() const -> std::uint32_t { return index_; }
+
+    /// \returns The generation of the connection's table entry.
+    auto generation() const -> std::uint32_t { return generation_; }
+
+    /// Return true if both handles refer to the same connection.
+    auto operator==(Connection_handle const& x) const -> bool
+    {
+        return table_ == x.table_ && index_ == x.index_ &&
+               generation_ == x.generation_;
+    }
+
+    /// Return !(*this == x)
+    auto operator!=(Connection_handle const& x) const -> bool
+    {
+        return !(*this == x);
+    }
+
+    /// Orders by table, then by index, then by generation.
+    auto operator<(Connection_handle const& x) const -> bool
+    {
+        if (table_ != x.table_)
+            return std::less<Connection_table_base const*>{}(table_, x.table_);
+        return index_ < x.index_ ||
+               (index_ == x.index_ && generation_ < x.generation_);
+    }
+
+    friend class Connection;
+    friend class Shared_connection_block;
+
+   private:
+    static constexpr std::uint64_t connected_bit =
+        Connection_table_base::connected_bit;
+    static constexpr std::uint64_t absent = Connection_table_base::absent;
+
+   private:
+    Connection_table_base const* table_ = nullptr;
+    std::uint32_t index_                = 0;
+    std::uint32_t generation_           = 0;
+
+   private:
+    auto state() const -> std::uint64_t
+    {
+        return table_ == nullptr ? absent : table_->state(index_, generation_);
+    }
+
+    void update(Connection_table_base::Update update) const
+    {
+        if (table_ != nullptr)
+            table_->update(index_, generation_, update);
+    }
+
+    // Query whether the connection still exists, connected or not.
+    auto alive() const -> bool { return this->state() != absent; }
+
+    void add_block() const
+    {
+        this->update(Connection_table_base::Update::add_block);
+    }
+
+    void remove_block() const
+    {
+        this->update(Connection_table_base::Update::remove_block);
+    }
+};
+
+}  // namespace sig
+
+namespace std {
+
+/// Hashes the index and generation of a Connection_handle.
+template <>
+struct hash<sig::Connection_handle> {
+    auto operator()(sig::Connection_handle const& h) const noexcept
+        -> std::size_t
+    {
+        return std::hash<std::uint64_t>{}(std::uint64_t{h.generation()} << 32 |
+                                          h.index());
+    }
+};
+
+}  // namespace std
+#endif  // SIGNALS_CONNECTION_HANDLE_HPP
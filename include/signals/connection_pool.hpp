@@ -0,0 +1,173 @@
+/// \file
+/// Slab allocator for the connections of one or more Signals.
+#ifndef SIGNALS_CONNECTION_POOL_HPP
+#define SIGNALS_CONNECTION_POOL_HPP
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace sig {
+
+/// Allocates connections from contiguous slabs and recycles them.
+/** Blocks are carved out of slabs holding blocks_per_slab blocks each, and a
+ *  freed block goes onto a free list for its size, so connect and disconnect
+ *  cycles reuse the same memory and the connections of a Signal sit next to
+ *  each other. Sizes are rounded up to a multiple of alignof(max_align_t),
+ *  blocks larger than max_block_size come from the global allocator. Slabs are
+ *  only released when the pool is destroyed. Each allocated connection keeps
+ *  its pool alive, so a pool may be shared by several Signals with the same
+ *  Mutex type and outlives them while any Connection refers to it.
+ *  \param Mutex Guards the free lists, Null_mutex if every Signal using the
+ *  pool is single threaded.
+ *  \sa Signal::set_connection_pool */
+template <typename Mutex = std::mutex>
+class Connection_pool {
+   public:
+    /// Size classes are multiples of this many bytes.
+    static constexpr std::size_t granularity = alignof(std::max_align_t);
+
+    /// Largest block served from slabs.
+    static constexpr std::size_t max_block_size = 32 * granularity;
+
+   public:
+    /// \param blocks_per_slab Number of blocks allocated at once per size.
+    explicit Connection_pool(std::size_t blocks_per_slab = 64)
+        : blocks_per_slab_{blocks_per_slab == 0 ? 1 : blocks_per_slab}
+    {}
+
+    Connection_pool(Connection_pool const&) = delete;
+
+    auto operator=(Connection_pool const&) -> Connection_pool& = delete;
+
+    ~Connection_pool() = default;
+
+   public:
+    /// \returns Storage for \p size bytes, aligned to max_align_t.
+    auto allocate(std::size_t size) -> void*
+    {
+        if (size > max_block_size)
+            return ::operator new(size);
+        auto const index = size_class(size);
+        auto const lock  = std::scoped_lock{mtx_};
+        if (free_[index] == nullptr)
+            this->grow(index);
+        auto* const block = free_[index];
+        free_[index]      = block->next;
+        ++in_use_;
+        return block;
+    }
+
+    /// Returns \p p, allocated with the same \p size, to its free list.
+    void deallocate(void* p, std::size_t size) noexcept
+    {
+        if (size > max_block_size) {
+            ::operator delete(p);
+            return;
+        }
+        auto const index  = size_class(size);
+        auto const lock   = std::scoped_lock{mtx_};
+        auto* const block = ::new (p) Free_block{free_[index]};
+        free_[index]      = block;
+        --in_use_;
+    }
+
+    /// \returns The number of slab blocks currently allocated.
+    auto in_use() const -> std::size_t
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        return in_use_;
+    }
+
+   private:
+    struct Free_block {
+        Free_block* next;
+    };
+
+    static constexpr auto class_count = max_block_size / granularity;
+
+   private:
+    std::size_t const blocks_per_slab_;
+    std::array<Free_block*, class_count> free_ = {};
+    std::vector<std::unique_ptr<std::byte[]>> slabs_;
+    std::size_t in_use_ = 0;
+    mutable Mutex mtx_;
+
+   private:
+    static auto size_class(std::size_t size) -> std::size_t
+    {
+        return size == 0 ? 0 : (size - 1) / granularity;
+    }
+
+    // Adds a slab of blocks to the empty free list at \p index, in address
+    // order so that consecutive allocations are adjacent.
+    void grow(std::size_t index)
+    {
+        auto const block_size = (index + 1) * granularity;
+        slabs_.push_back(
+            std::make_unique<std::byte[]>(block_size * blocks_per_slab_));
+        auto* const slab = slabs_.back().get();
+        for (auto i = blocks_per_slab_; i != 0; --i) {
+            free_[index] =
+                ::new (slab + (i - 1) * block_size) Free_block{free_[index]};
+        }
+    }
+};
+
+/// Allocator drawing from a shared Connection_pool, for std::allocate_shared.
+template <typename T, typename Mutex = std::mutex>
+class Connection_pool_allocator {
+   public:
+    using value_type = T;
+
+   public:
+    explicit Connection_pool_allocator(
+        std::shared_ptr<Connection_pool<Mutex>> pool)
+        : pool_{std::move(pool)}
+    {}
+
+    template <typename U>
+    Connection_pool_allocator(Connection_pool_allocator<U, Mutex> const& other)
+        : pool_{other.pool()}
+    {}
+
+   public:
+    auto allocate(std::size_t n) -> T*
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t),
+                      "Over-aligned types cannot be pooled.");
+        return static_cast<T*>(pool_->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        pool_->deallocate(p, n * sizeof(T));
+    }
+
+    auto pool() const -> std::shared_ptr<Connection_pool<Mutex>> const&
+    {
+        return pool_;
+    }
+
+    template <typename U>
+    auto operator==(Connection_pool_allocator<U, Mutex> const& x) const
+        -> bool
+    {
+        return pool_ == x.pool();
+    }
+
+    template <typename U>
+    auto operator!=(Connection_pool_allocator<U, Mutex> const& x) const
+        -> bool
+    {
+        return !operator==(x);
+    }
+
+   private:
+    std::shared_ptr<Connection_pool<Mutex>> pool_;
+};
+
+}  // namespace sig
+#endif  // SIGNALS_CONNECTION_POOL_HPP
@@ -0,0 +1,312 @@
+#ifndef SIGNALS_DETAIL_CONNECTION_CONTAINER_HPP
+#define SIGNALS_DETAIL_CONNECTION_CONTAINER_HPP
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "../position.hpp"
+
+namespace sig {
+
+// Flat dispatch array holding every connection of a Signal in call order:
+// ungrouped at_front connections, then each group in Group_compare order, then
+// ungrouped at_back connections. Elements live in one contiguous vector, with
+// unused headroom before the first element so that ungrouped at_front inserts
+// into the container are amortized O(1), like at_back ones. Inserting into a
+// group shifts every later element, O(n). Group boundaries are kept in a small
+// sorted index of offsets, relative to the first element, one past the end of
+// each group. These costs are the container's own, the Signal copies the whole
+// array into a new snapshot after each change.
+template <typename Connection_ptr, typename Group, typename Group_compare>
+class Connection_container {
+   public:
+    using const_iterator =
+        typename std::vector<Connection_ptr>::const_iterator;
+
+   public:
+    Connection_container() = default;
+
+    explicit Connection_container(Group_compare const& compare)
+        : compare_{compare}
+    {}
+
+    Connection_container(Connection_container const&) = default;
+
+    // Leaves \p other empty, its offsets would not match its moved from slots_.
+    Connection_container(Connection_container&& other) noexcept
+        : slots_{std::move(other.slots_)},
+          groups_{std::move(other.groups_)},
+          head_{std::exchange(other.head_, 0)},
+          front_size_{std::exchange(other.front_size_, 0)},
+          compare_{other.compare_}
+    {
+        other.clear();
+    }
+
+    auto operator=(Connection_container const&)
+        -> Connection_container& = default;
+
+    auto operator=(Connection_container&& other) noexcept
+        -> Connection_container&
+    {
+        if (this != &other) {
+            slots_      = std::move(other.slots_);
+            groups_     = std::move(other.groups_);
+            head_       = std::exchange(other.head_, 0);
+            front_size_ = std::exchange(other.front_size_, 0);
+            compare_    = other.compare_;
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~Connection_container() = default;
+
+   public:
+    // Inserts an ungrouped connection at the very front or back.
+    void insert(Connection_ptr connection, Position position)
+    {
+        if (position == Position::at_back) {
+            slots_.push_back(std::move(connection));
+            return;
+        }
+        if (head_ == 0)
+            this->grow_headroom();
+        --head_;
+        slots_[head_] = std::move(connection);
+        ++front_size_;
+        for (auto& index : groups_)
+            ++index.end;
+    }
+
+    // Inserts a connection at the front or back of \p group.
+    void insert(Group const& group,
+                Connection_ptr connection,
+                Position position)
+    {
+        auto index = this->find_or_add(group);
+        auto const offset =
+            position == Position::at_front ? this->begin_of(index) : index->end;
+        slots_.insert(std::begin(slots_) + head_ + offset,
+                      std::move(connection));
+        for (; index != std::end(groups_); ++index)
+            ++index->end;
+    }
+
+    // Inserts the ungrouped connections [first, last) as one block at the very
+    // front or back, keeping their order, with at most one reallocation.
+    template <typename Iter>
+    void insert_range(Iter first, Iter last, Position position)
+    {
+        if (position == Position::at_back) {
+            slots_.insert(std::end(slots_), first, last);
+            return;
+        }
+        auto const count = static_cast<std::size_t>(std::distance(first, last));
+        if (head_ < count)
+            this->grow_headroom(count);
+        head_ -= count;
+        std::copy(first, last, std::begin(slots_) + head_);
+        front_size_ += count;
+        for (auto& index : groups_)
+            index.end += count;
+    }
+
+    // Inserts the connections [first, last) as one block at the front or back
+    // of \p group, keeping their order, with at most one reallocation.
+    template <typename Iter>
+    void insert_range(Group const& group,
+                      Iter first,
+                      Iter last,
+                      Position position)
+    {
+        auto const count = static_cast<std::size_t>(std::distance(first, last));
+        if (count == 0)
+            return;
+        auto index = this->find_or_add(group);
+        auto const offset =
+            position == Position::at_front ? this->begin_of(index) : index->end;
+        slots_.insert(std::begin(slots_) + head_ + offset, first, last);
+        for (; index != std::end(groups_); ++index)
+            index->end += count;
+    }
+
+    // Range of connections in \p group, empty if there is no such group.
+    auto group_range(Group const& group) const
+        -> std::pair<const_iterator, const_iterator>
+    {
+        auto const index = this->find(group);
+        if (index == std::end(groups_))
+            return {this->end(), this->end()};
+        return {this->begin() + this->begin_of(index),
+                this->begin() + index->end};
+    }
+
+    // Erases every connection in \p group, along with the group itself.
+    void erase_group(Group const& group)
+    {
+        auto index = this->find(group);
+        if (index == std::end(groups_))
+            return;
+        auto const first = this->begin_of(index);
+        auto const count = index->end - first;
+        slots_.erase(std::begin(slots_) + head_ + first,
+                     std::begin(slots_) + head_ + index->end);
+        index = groups_.erase(index);
+        for (; index != std::end(groups_); ++index)
+            index->end -= count;
+    }
+
+    // Erases connections for which \p predicate returns true in a single pass,
+    // preserving call order and dropping groups left empty.
+    template <typename Predicate>
+    void remove_if(Predicate&& predicate)
+    {
+        auto write = head_;
+        auto read  = head_;
+        // Compacts up to the absolute position \p section_end, returns the
+        // new end of the section relative to head_.
+        auto const compact_to = [&](std::size_t section_end) {
+            for (; read != section_end; ++read) {
+                if (!predicate(slots_[read])) {
+                    if (write != read)
+                        slots_[write] = std::move(slots_[read]);
+                    ++write;
+                }
+            }
+            return write - head_;
+        };
+        front_size_ = compact_to(head_ + front_size_);
+        for (auto& index : groups_)
+            index.end = compact_to(head_ + index.end);
+        compact_to(slots_.size());
+        slots_.erase(std::begin(slots_) + write, std::end(slots_));
+
+        auto previous_end = front_size_;
+        auto kept         = std::begin(groups_);
+        for (auto& index : groups_) {
+            auto const is_empty = index.end == previous_end;
+            previous_end        = index.end;
+            if (is_empty)
+                continue;
+            if (&*kept != &index)
+                *kept = std::move(index);
+            ++kept;
+        }
+        groups_.erase(kept, std::end(groups_));
+    }
+
+    // Erases every connection.
+    void clear()
+    {
+        slots_.clear();
+        groups_.clear();
+        head_       = 0;
+        front_size_ = 0;
+    }
+
+    auto begin() const -> const_iterator
+    {
+        return std::cbegin(slots_) + head_;
+    }
+
+    auto end() const -> const_iterator { return std::cend(slots_); }
+
+    auto size() const -> std::size_t { return slots_.size() - head_; }
+
+    // Number of ungrouped at_front connections.
+    auto front_size() const -> std::size_t { return front_size_; }
+
+    // Offset one past the last connection of each group, in call order.
+    auto group_ends() const -> std::vector<std::size_t>
+    {
+        auto ends = std::vector<std::size_t>{};
+        ends.reserve(groups_.size());
+        for (auto const& index : groups_)
+            ends.push_back(index.end);
+        return ends;
+    }
+
+    auto empty() const -> bool { return this->size() == 0; }
+
+   private:
+    struct Group_index {
+        Group group;
+        std::size_t end;
+    };
+
+    using Index_iterator = typename std::vector<Group_index>::iterator;
+    using Index_const_iterator =
+        typename std::vector<Group_index>::const_iterator;
+
+   private:
+    std::vector<Connection_ptr> slots_;
+    std::vector<Group_index> groups_;
+    std::size_t head_       = 0;
+    std::size_t front_size_ = 0;
+    Group_compare compare_;
+
+   private:
+    // Reallocates with headroom before the first element equal to the current
+    // number of elements, so at_front inserts double like push_back does, and
+    // at least \p needed.
+    void grow_headroom(std::size_t needed = 1)
+    {
+        auto const count    = this->size();
+        auto const headroom = std::max({count, needed, std::size_t{4}});
+        auto grown          = std::vector<Connection_ptr>{};
+        grown.reserve(headroom + count * 2);
+        grown.resize(headroom);
+        grown.insert(std::end(grown),
+                     std::make_move_iterator(std::begin(slots_) + head_),
+                     std::make_move_iterator(std::end(slots_)));
+        slots_ = std::move(grown);
+        head_  = headroom;
+    }
+
+    // Offset of the first connection in the group at \p index.
+    template <typename Iter>
+    auto begin_of(Iter index) const -> std::size_t
+    {
+        return index == std::begin(groups_) ? front_size_
+                                            : std::prev(index)->end;
+    }
+
+    auto lower_bound(Group const& group) const -> Index_const_iterator
+    {
+        auto const less = [this](Group_index const& index, Group const& g) {
+            return compare_(index.group, g);
+        };
+        return std::lower_bound(std::begin(groups_), std::end(groups_), group,
+                                less);
+    }
+
+    auto find(Group const& group) const -> Index_const_iterator
+    {
+        auto const index = this->lower_bound(group);
+        if (index == std::end(groups_) || compare_(group, index->group))
+            return std::end(groups_);
+        return index;
+    }
+
+    auto find(Group const& group) -> Index_iterator
+    {
+        auto const index = std::as_const(*this).find(group);
+        return std::begin(groups_) + (index - std::cbegin(groups_));
+    }
+
+    auto find_or_add(Group const& group) -> Index_iterator
+    {
+        auto const found = this->lower_bound(group);
+        auto index       = std::begin(groups_) + (found - std::cbegin(groups_));
+        if (index != std::end(groups_) && !compare_(group, index->group))
+            return index;
+        auto const end = this->begin_of(index);
+        return groups_.insert(index, Group_index{group, end});
+    }
+};
+
+}  // namespace sig
+#endif  // SIGNALS_DETAIL_CONNECTION_CONTAINER_HPP
@@ -1,32 +1,63 @@
 #ifndef SIGNALS_DETAIL_CONNECTION_IMPL_HPP
 #define SIGNALS_DETAIL_CONNECTION_IMPL_HPP
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
-#include <mutex>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include "../connection.hpp"
+#include "../dispatcher.hpp"
 #include "../slot.hpp"
-#include "connection_impl_base.hpp"
+#include "../threading.hpp"
+#include "connection_state.hpp"
+#include "slot_recorder.hpp"
+
+#ifdef SIGNALS_ENABLE_TRACING
+#include "../tracer.hpp"
+#endif
 
 namespace sig {
 class Connection;
 
-template <typename Signature>
+template <typename Signature,
+          typename Slot_function = std::function<Signature>,
+          typename Threading     = Multi_threaded>
 class Connection_impl;
 
 // Implementation class for Connection. This class owns the Slot involved in
-// the connection. Inherits from Connection_impl_base, which implements shared
-// connection block counts.
-template <typename R, typename... Args>
-class Connection_impl<R(Args...)> : public Connection_impl_base {
+// the connection. Inherits from Connection_state, which implements the
+// connected flag and shared connection block counts for the given threading
+// policy. Final, so Signals calling through a Connection_impl pointer do not
+// go through the virtual interface of Connection_impl_base.
+template <typename R,
+          typename... Args,
+          typename Slot_function,
+          typename Threading>
+class Connection_impl<R(Args...), Slot_function, Threading> final
+    : public Connection_state<Threading> {
    public:
+    using Result_t        = R;
+    using Slot_t          = Slot<R(Args...), Slot_function>;
     using Extended_slot_t = Slot<R(Connection const&, Args...)>;
+    using Table           = Connection_table<Threading>;
 
    public:
-    Connection_impl() : slot_{}, connected_{false} {}
+    Connection_impl() : Connection_state<Threading>{false}, slot_{} {}
+
+    explicit Connection_impl(Slot_t s)
+        : Connection_state<Threading>{true}, slot_{std::move(s)}
+    {}
+
+    // Constructors used by Signal, registering the connection in \p table.
+    explicit Connection_impl(Table& table)
+        : Connection_state<Threading>{table, false}, slot_{}
+    {}
 
-    explicit Connection_impl(Slot<R(Args...)> s)
-        : slot_{std::move(s)}, connected_{true}
+    Connection_impl(Table& table, Slot_t s)
+        : Connection_state<Threading>{table, true}, slot_{std::move(s)}
     {}
 
    public:
@@ -37,37 +68,161 @@ class Connection_impl<R(Args...)> : public Connection_impl_base {
     auto emplace_extended(Extended_slot_t const& es, Connection const& c)
         -> Connection_impl&
     {
-        auto const lock = std::lock_guard{mtx_};
-        connected_      = true;
-
         slot_.slot_function() = [c, es](Args&&... args) {
             return es.slot_function()(c, std::forward<Args>(args)...);
         };
         for (std::weak_ptr<void> const& wp : es.get_tracked_container()) {
             slot_.track(wp);
         }
+        this->set_connected();
+        return *this;
+    }
+
+    // Constructs a queued connection to \p target. The slot function posts a
+    // task holding a copy of the arguments to \p dispatcher, the task calls
+    // \p target if the connection \p c is still connected by then. Tracked
+    // items are copied so that expired targets are not queued at all, the
+    // target still checks them itself when it is finally called. Besides the
+    // arguments a task captures a std::shared_ptr<Queued const>, which keeps
+    // the target alive until the task has run even if the connection is gone,
+    // so arguments of up to Dispatcher::argument_capacity bytes are stored
+    // inline in the ring.
+    auto emplace_queued(Slot_t target, Dispatcher& dispatcher, Connection c)
+        -> Connection_impl&
+    {
+        static_assert(sizeof(std::shared_ptr<Queued const>) <=
+                          Dispatcher::task_capacity -
+                              Dispatcher::argument_capacity,
+                      "Queued task captures exceed the reserved room.");
+        for (std::weak_ptr<void> const& wp : target.get_tracked_container())
+            slot_.track(wp);
+        slot_.slot_function() =
+            [d = &dispatcher, q = std::make_shared<Queued const>(
+                                  Queued{c.handle(), std::move(target)})](
+                Args&&... args) {
+                d->post([q, bound = std::tuple<std::decay_t<Args>...>{
+                                std::forward<Args>(args)...}]() mutable {
+                    if (q->handle.connected())
+                        std::apply(q->target, std::move(bound));
+                });
+            };
+        this->set_connected();
         return *this;
     }
 
-    void disconnect() override
+    // Calls the Slot with the elements of \p args. With SIGNALS_ENABLE_STATS
+    // the call is counted and timed, with SIGNALS_ENABLE_TRACING it is traced
+    // under the label of the connection while the Tracer is active.
+    template <typename Tuple>
+    auto call(Tuple&& args) const -> R
+    {
+        return this->invoke(slot_, std::forward<Tuple>(args));
+    }
+
+    // call() for a caller that already pinned the tracked objects of the
+    // Slot, they are not checked again.
+    template <typename Tuple>
+    auto call_pinned(Tuple&& args) const -> R
+    {
+        return this->invoke(slot_.slot_function(), std::forward<Tuple>(args));
+    }
+
+    // call_pinned() with the elements of \p args, a tuple of forwarding
+    // references, passing on as rvalues those bound to rvalues, unless the
+    // Slot takes that parameter by lvalue reference.
+    template <typename... Bound>
+    auto call_forwarding(std::tuple<Bound...> const& args) const -> R
     {
-        auto const lock = std::lock_guard{mtx_};
-        connected_      = false;
+        return this->call_pinned(
+            forwarded(args, std::index_sequence_for<Args...>{}));
     }
 
-    auto connected() const -> bool override
+    // True if every parameter the Slot takes by value can be copied, so the
+    // arguments of one emission can be passed to several Slots.
+    static constexpr bool copyable_arguments =
+        ((std::is_reference_v<Args> || std::is_copy_constructible_v<Args>) &&
+         ...);
+
+    // Counts \p count emissions passing over this connection, a no-op unless
+    // SIGNALS_ENABLE_STATS is defined.
+    void skipped([[maybe_unused]] Skip_reason reason,
+                 [[maybe_unused]] std::uint64_t count = 1) const
+    {
+#ifdef SIGNALS_ENABLE_STATS
+        recorder_.skip(reason, count);
+#endif
+    }
+
+#ifdef SIGNALS_ENABLE_STATS
+    // Counters of this connection.
+    auto recorder() const -> Slot_recorder<Threading>& { return recorder_; }
+#endif
+
+#ifdef SIGNALS_ENABLE_TRACING
+    // Name of the Slot in traces, \p label must live as long as the process.
+    void set_label(char const* label)
+    {
+        label_.store(label, std::memory_order_relaxed);
+    }
+
+    auto label() const -> char const*
+    {
+        return label_.load(std::memory_order_relaxed);
+    }
+#endif
+
+    auto get_slot() -> Slot_t& { return slot_; }
+
+    auto get_slot() const -> Slot_t const& { return slot_; }
+
+   private:
+    // Target of a queued connection, shared by every task it posts.
+    struct Queued {
+        Connection_handle handle;
+        Slot_t target;
+    };
+
+    template <std::size_t I>
+    using Parameter_t = std::tuple_element_t<I, std::tuple<Args...>>;
+
+    template <typename F, typename Tuple>
+    auto invoke(F const& f, Tuple&& args) const -> R
     {
-        auto const lock = std::lock_guard{mtx_};
-        return connected_;
+#ifdef SIGNALS_ENABLE_TRACING
+        auto const trace = Trace_scope{this->label(), "slot"};
+#endif
+#ifdef SIGNALS_ENABLE_STATS
+        return recorder_.time([&]() -> decltype(auto) {
+            return std::apply(f, std::forward<Tuple>(args));
+        });
+#else
+        return std::apply(f, std::forward<Tuple>(args));
+#endif
     }
 
-    auto get_slot() -> Slot<R(Args...)>& { return slot_; }
+    // Reference the I-th Slot parameter is passed as, an lvalue reference if
+    // the bound argument is an lvalue or the parameter is an lvalue reference.
+    template <std::size_t I, typename Tuple>
+    using Forwarded_t =
+        std::conditional_t<std::is_lvalue_reference_v<Parameter_t<I>>,
+                           std::tuple_element_t<I, Tuple>&,
+                           std::tuple_element_t<I, Tuple>&&>;
 
-    auto get_slot() const -> Slot<R(Args...)> const& { return slot_; }
+    template <typename Tuple, std::size_t... I>
+    static auto forwarded(Tuple const& args, std::index_sequence<I...>)
+    {
+        return std::tuple<Forwarded_t<I, Tuple>...>{
+            static_cast<Forwarded_t<I, Tuple>>(std::get<I>(args))...};
+    }
 
    private:
-    Slot<R(Args...)> slot_;
-    bool connected_;
+    Slot_t slot_;
+#ifdef SIGNALS_ENABLE_STATS
+    mutable Slot_recorder<Threading> recorder_;
+#endif
+#ifdef SIGNALS_ENABLE_TRACING
+    typename Threading::template Atomic<char const*> label_ = "Slot";
+#endif
 };
 
 }  // namespace sig
@@ -0,0 +1,136 @@
+#ifndef SIGNALS_DETAIL_CONNECTION_STATE_HPP
+#define SIGNALS_DETAIL_CONNECTION_STATE_HPP
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "../connection_handle.hpp"
+#include "../threading.hpp"
+#include "connection_impl_base.hpp"
+#include "connection_table.hpp"
+
+namespace sig {
+
+// Implements the connected flag and the shared connection block count of a
+// connection. Both are packed into a single word stored inline, the lowest bit
+// is the connected flag and the bits above it count blocks, so every query and
+// update is a single operation on memory the Signal already touches. For the
+// lifetime of *this the word is registered in an entry of the Signal's
+// Connection_table, through which Connection_handles reach it. With the
+// Multi_threaded policy updates are atomic read modify writes, with
+// Single_threaded they are a plain load and store.
+template <typename Threading>
+class Connection_state : public Connection_impl_base {
+   public:
+    using Table = Connection_table<Threading>;
+
+   public:
+    Connection_state() : Connection_state{false} {}
+
+    // Registered in the table for connections made outside of a Signal.
+    explicit Connection_state(bool connected)
+        : Connection_state{Table::standalone(), connected}
+    {}
+
+    Connection_state(Table& table, bool connected)
+        : word_{connected ? connected_bit : 0},
+          table_{&table},
+          index_{table.acquire(word_)}
+    {}
+
+    // Copies take a new entry of the same table, holding the same state.
+    Connection_state(Connection_state const& other)
+        : word_{other.load()},
+          table_{other.table_},
+          index_{table_->acquire(word_)}
+    {}
+
+    Connection_state(Connection_state&& other)
+        : Connection_state{static_cast<Connection_state const&>(other)}
+    {}
+
+    auto operator=(Connection_state const& rhs) -> Connection_state&
+    {
+        if (this != &rhs)
+            word_.store(rhs.load(), std::memory_order_release);
+        return *this;
+    }
+
+    auto operator=(Connection_state&& rhs) -> Connection_state&
+    {
+        return *this = static_cast<Connection_state const&>(rhs);
+    }
+
+    ~Connection_state() override { table_->release(index_); }
+
+   public:
+    void disconnect() final
+    {
+        if constexpr (synchronized)
+            word_.fetch_and(~connected_bit, std::memory_order_acq_rel);
+        else
+            word_.store(this->load() & ~connected_bit);
+    }
+
+    auto connected() const -> bool final
+    {
+        return (this->load() & connected_bit) != 0;
+    }
+
+    auto blocked() const -> bool final
+    {
+        return (this->load() & ~connected_bit) != 0;
+    }
+
+    void add_block() final
+    {
+        if constexpr (synchronized)
+            word_.fetch_add(block_unit, std::memory_order_acq_rel);
+        else
+            word_.store(this->load() + block_unit);
+    }
+
+    void remove_block() final
+    {
+        if constexpr (synchronized)
+            word_.fetch_sub(block_unit, std::memory_order_acq_rel);
+        else
+            word_.store(this->load() - block_unit);
+    }
+
+    auto handle() const -> Connection_handle final
+    {
+        return {*table_, index_, table_->generation(index_)};
+    }
+
+   protected:
+    // Sets the connected flag, leaving the block count untouched.
+    void set_connected()
+    {
+        if constexpr (synchronized)
+            word_.fetch_or(connected_bit, std::memory_order_acq_rel);
+        else
+            word_.store(this->load() | connected_bit);
+    }
+
+   private:
+    static constexpr std::uint64_t connected_bit = Table::connected_bit;
+    static constexpr std::uint64_t block_unit    = Table::block_unit;
+
+    static constexpr bool synchronized =
+        !std::is_same_v<Threading, Single_threaded>;
+
+    typename Table::Word word_;
+    Table* table_;
+    std::uint32_t index_;
+
+   private:
+    auto load() const -> std::uint64_t
+    {
+        return word_.load(synchronized ? std::memory_order_acquire
+                                       : std::memory_order_relaxed);
+    }
+};
+
+}  // namespace sig
+#endif  // SIGNALS_DETAIL_CONNECTION_STATE_HPP
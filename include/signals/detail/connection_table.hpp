@@ -0,0 +1,375 @@
+#ifndef SIGNALS_DETAIL_CONNECTION_TABLE_HPP
+#define SIGNALS_DETAIL_CONNECTION_TABLE_HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../threading.hpp"
+
+namespace sig {
+
+// Interface Connection_handles reach a table through, so that handles stay
+// non-templated whatever the threading policy of their Signal.
+class Connection_table_base {
+   public:
+    // Lowest bit of a connection's state word is the connected flag, the bits
+    // above it count shared connection blocks.
+    static constexpr std::uint64_t connected_bit = 1;
+    static constexpr std::uint64_t block_unit    = 2;
+
+    // Returned by state() for an entry that no longer belongs to the
+    // connection of the handle, no live state has every bit set.
+    static constexpr std::uint64_t absent = ~std::uint64_t{0};
+
+    enum class Update { disconnect, add_block, remove_block };
+
+   public:
+    // State word of the connection at \p index, or absent unless the entry's
+    // generation is still \p generation.
+    virtual auto state(std::uint32_t index, std::uint32_t generation) const
+        -> std::uint64_t = 0;
+
+    // Applies \p update to the state word of the connection at \p index, a
+    // no-op unless the entry's generation is still \p generation.
+    virtual void update(std::uint32_t index,
+                        std::uint32_t generation,
+                        Update update) const = 0;
+
+   protected:
+    ~Connection_table_base() = default;
+};
+
+// Index of the connections of one Signal, shared by its copies. Each live
+// connection owns one entry, which points at the state word stored inline in
+// the connection and holds the entry's generation, bumped each time the entry
+// is released. A Connection_handle is a table pointer, an index and a
+// generation, and compares generations to tell whether the entry still belongs
+// to its connection. Generation zero is never used, so a default handle
+// matches no entry.
+//
+// Entries live in chunks, each twice the size of the one before it, that are
+// never freed: when the last Signal and connection using a table are gone the
+// table is kept on a free list of its threading policy and handed to the next
+// Signal that connects a Slot, generations carry on, so a stale handle stays
+// safe to use at any time. Acquiring and releasing entries take the table's
+// own lock, never a process-wide one.
+//
+// With the Multi_threaded policy a handle pins the entry while it reads or
+// updates the state word, and releasing waits until no pins are left before
+// bumping the generation, so the word is never touched after its connection
+// is destroyed. With Single_threaded every member is an Unsynchronized value
+// and the lock is a Null_mutex, a handle compares the generation and goes
+// straight to the word.
+template <typename Threading>
+class Connection_table final : public Connection_table_base {
+   public:
+    using Word = typename Threading::template Atomic<std::uint64_t>;
+
+    // Number of entries a table holds at most.
+    static constexpr std::size_t max_size = std::size_t{1} << 31;
+
+    // Counted reference to a table, held by Signals. The table goes back to
+    // the free list once no reference and no entry is left.
+    class Ref {
+       public:
+        Ref() = default;
+
+        Ref(Ref const& other) : table_{other.table_}
+        {
+            if (table_ != nullptr)
+                table_->retain();
+        }
+
+        Ref(Ref&& other) noexcept : table_{std::exchange(other.table_, nullptr)}
+        {}
+
+        auto operator=(Ref other) noexcept -> Ref&
+        {
+            std::swap(table_, other.table_);
+            return *this;
+        }
+
+        ~Ref()
+        {
+            if (table_ != nullptr)
+                table_->drop();
+        }
+
+       public:
+        // Table of *this, taken from the free list on first use.
+        auto get() -> Connection_table&
+        {
+            if (table_ == nullptr)
+                table_ = Connection_table::take();
+            return *table_;
+        }
+
+       private:
+        Connection_table* table_ = nullptr;
+    };
+
+   public:
+    Connection_table(Connection_table const&) = delete;
+
+    auto operator=(Connection_table const&) -> Connection_table& = delete;
+
+   public:
+    // Table for connections made outside of a Signal, kept for the lifetime
+    // of the process.
+    static auto standalone() -> Connection_table&
+    {
+        static auto* const table = take();
+        return *table;
+    }
+
+    // Takes a free entry for the connection whose state is \p word, recently
+    // released entries are reused first. The entry keeps *this alive.
+    auto acquire(Word& word) -> std::uint32_t
+    {
+        auto const lock = std::lock_guard{mtx_};
+        auto index      = free_;
+        if (index != 0) {
+            --index;
+            free_ = this->entry(index).next;
+        }
+        else {
+            if (size_ == max_size)
+                throw std::length_error{"Connection_table is full."};
+            index = static_cast<std::uint32_t>(size_);
+            this->reserve(index);
+            ++size_;
+        }
+        this->entry(index).word = &word;
+        this->retain();
+        return index;
+    }
+
+    // Bumps the generation of the entry at \p index, so that handles to it no
+    // longer match, and puts it back on the free list. Waits for handles that
+    // pinned the entry before the bump to let go of it.
+    void release(std::uint32_t index) noexcept
+    {
+        auto& entry = this->entry(index);
+        auto tag    = entry.tag.load(std::memory_order_relaxed);
+        if constexpr (synchronized) {
+            for (;;) {
+                if ((tag & pin_mask) != 0) {
+                    std::this_thread::yield();
+                    tag = entry.tag.load(std::memory_order_relaxed);
+                }
+                else if (entry.tag.compare_exchange_weak(
+                             tag, next_generation(tag),
+                             std::memory_order_acq_rel,
+                             std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+        }
+        else {
+            entry.tag.store(next_generation(tag), std::memory_order_relaxed);
+        }
+        {
+            auto const lock = std::lock_guard{mtx_};
+            entry.next      = free_;
+            free_           = index + 1;
+        }
+        this->drop();
+    }
+
+    // Generation of the entry at \p index, stable while it is acquired.
+    auto generation(std::uint32_t index) const -> std::uint32_t
+    {
+        return static_cast<std::uint32_t>(
+            this->entry(index).tag.load(std::memory_order_relaxed) >> 32);
+    }
+
+    auto state(std::uint32_t index, std::uint32_t generation) const
+        -> std::uint64_t override
+    {
+        auto& entry = this->entry(index);
+        if (!this->pin(entry, generation))
+            return absent;
+        auto const state = entry.word->load(std::memory_order_acquire);
+        this->unpin(entry);
+        return state;
+    }
+
+    void update(std::uint32_t index,
+                std::uint32_t generation,
+                Update update) const override
+    {
+        auto& entry = this->entry(index);
+        if (!this->pin(entry, generation))
+            return;
+        auto& word = *entry.word;
+        switch (update) {
+            case Update::disconnect:
+                word.fetch_and(~connected_bit, std::memory_order_acq_rel);
+                break;
+            case Update::add_block:
+                word.fetch_add(block_unit, std::memory_order_acq_rel);
+                break;
+            case Update::remove_block:
+                word.fetch_sub(block_unit, std::memory_order_acq_rel);
+                break;
+        }
+        this->unpin(entry);
+    }
+
+   private:
+    using Mutex = typename Threading::Mutex;
+
+    // The upper half of a tag is the entry's generation, the lower half counts
+    // the handles currently pinning the entry.
+    struct Entry {
+        typename Threading::template Atomic<std::uint64_t> tag =
+            generation_unit;
+        Word* word         = nullptr;
+        std::uint32_t next = 0;  // One past the next free entry, as free_.
+    };
+
+    static constexpr bool synchronized =
+        !std::is_same_v<Threading, Single_threaded>;
+
+    static constexpr std::uint64_t generation_unit = std::uint64_t{1} << 32;
+    static constexpr std::uint64_t pin_mask        = generation_unit - 1;
+
+    static constexpr std::size_t first_bits  = 4;
+    static constexpr std::size_t first_size  = std::size_t{1} << first_bits;
+    static constexpr std::size_t chunk_count = 31 - first_bits + 1;
+
+    using Chunk = typename Threading::template Atomic<Entry*>;
+
+    std::array<Chunk, chunk_count> chunks_ = {};
+    typename Threading::template Atomic<std::size_t> refs_ = 0;
+    Mutex mtx_;
+    std::size_t size_   = 0;  // Guarded by mtx_, as is free_.
+    std::uint32_t free_ = 0;  // One past the first free entry, zero if none.
+
+   private:
+    Connection_table() = default;
+
+    // A table with one reference, from the free list if there is one.
+    static auto take() -> Connection_table*
+    {
+        auto& [mtx, tables] = free_tables();
+        auto table          = static_cast<Connection_table*>(nullptr);
+        {
+            auto const lock = std::lock_guard{mtx};
+            if (!tables.empty()) {
+                table = tables.back();
+                tables.pop_back();
+            }
+        }
+        if (table == nullptr)
+            table = new Connection_table;
+        table->refs_.store(1, std::memory_order_relaxed);
+        return table;
+    }
+
+    // Tables no longer used by any Signal or connection, never destroyed, so
+    // that handles to them stay safe during static destruction.
+    static auto free_tables()
+        -> std::pair<std::mutex, std::vector<Connection_table*>>&
+    {
+        static auto* const tables =
+            new std::pair<std::mutex, std::vector<Connection_table*>>{};
+        return *tables;
+    }
+
+    void retain() { refs_.fetch_add(1, std::memory_order_relaxed); }
+
+    void drop() noexcept
+    {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+        auto& [mtx, tables] = free_tables();
+        auto const lock     = std::lock_guard{mtx};
+        try {
+            tables.push_back(this);
+        }
+        catch (...) {
+            // Leaked rather than freed, handles may still refer to it.
+        }
+    }
+
+    static auto next_generation(std::uint64_t tag) -> std::uint64_t
+    {
+        auto const next = (tag & ~pin_mask) + generation_unit;
+        return next == 0 ? generation_unit : next;
+    }
+
+    // Pins \p entry while its generation is \p generation. Single_threaded
+    // entries only compare the generation.
+    auto pin(Entry& entry, std::uint32_t generation) const -> bool
+    {
+        auto tag = entry.tag.load(std::memory_order_acquire);
+        if constexpr (synchronized) {
+            while ((tag >> 32) == generation) {
+                if (entry.tag.compare_exchange_weak(tag, tag + 1,
+                                                    std::memory_order_acquire,
+                                                    std::memory_order_acquire))
+                    return true;
+            }
+            return false;
+        }
+        else {
+            return (tag >> 32) == generation;
+        }
+    }
+
+    void unpin([[maybe_unused]] Entry& entry) const
+    {
+        if constexpr (synchronized)
+            entry.tag.fetch_sub(1, std::memory_order_release);
+    }
+
+    static auto chunk_size(std::size_t chunk) -> std::size_t
+    {
+        return chunk == 0 ? first_size : first_size << (chunk - 1);
+    }
+
+    auto entry(std::uint32_t index) const -> Entry&
+    {
+        auto const [c, first] = locate_first(index);
+        return chunks_[c].load(std::memory_order_acquire)[index - first];
+    }
+
+    // Chunk holding \p index, and the index of the chunk's first entry.
+    static auto locate_first(std::uint32_t index)
+        -> std::pair<std::size_t, std::uint32_t>
+    {
+        if (index < first_size)
+            return {0, 0};
+        auto log = std::size_t{0};
+        for (auto shift : {16u, 8u, 4u, 2u, 1u}) {
+            if ((index >> shift) != 0) {
+                index >>= shift;
+                log += shift;
+            }
+        }
+        return {log - first_bits + 1, std::uint32_t{1} << log};
+    }
+
+    // Allocates the chunk holding \p index unless it exists. Must be called
+    // with mtx_ held.
+    void reserve(std::uint32_t index)
+    {
+        auto const c = locate_first(index).first;
+        if (chunks_[c].load(std::memory_order_relaxed) != nullptr)
+            return;
+        auto chunk = std::make_unique<Entry[]>(chunk_size(c));
+        chunks_[c].store(chunk.release(), std::memory_order_release);
+    }
+};
+
+}  // namespace sig
+#endif  // SIGNALS_DETAIL_CONNECTION_TABLE_HPP
@@ -0,0 +1,286 @@
+#ifndef SIGNALS_DETAIL_EMISSION_WAITERS_HPP
+#define SIGNALS_DETAIL_EMISSION_WAITERS_HPP
+#ifdef SIGNALS_ENABLE_COROUTINES
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "SIGNALS_ENABLE_COROUTINES needs a compiler with C++20 coroutines."
+#endif
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace sig {
+
+// Coroutines suspended until the next emission of a Signal. Each waiter is a
+// node of an intrusive list, the node lives inside the awaiter object, which
+// itself lives in the suspended coroutine's frame, so waiting allocates
+// nothing. An emission copies its arguments into every waiter under the lock,
+// unlinks the one-shot waiters and collects the coroutines to resume, then
+// resumes them on the emitting thread after unlocking, without touching a node
+// again, as a resumed coroutine may destroy the other waiters. A Signal with no waiters only pays for a relaxed load
+// of the waiter count. Tuple holds a copy of the emission arguments.
+template <typename Tuple, typename Mutex, typename Threading>
+class Emission_waiters {
+   private:
+    using Lock_t = std::scoped_lock<Mutex>;
+
+    struct Node {
+        Node* prev              = nullptr;
+        Node* next              = nullptr;
+        Emission_waiters* owner = nullptr;
+        std::coroutine_handle<> handle;
+        bool persistent = false;
+
+        // Stores \p args, called under the owner's lock. Returns the waiting
+        // coroutine if it needs to be resumed, a null handle otherwise.
+        virtual auto deliver(Tuple const& args) -> std::coroutine_handle<> = 0;
+
+       protected:
+        ~Node() = default;
+    };
+
+   public:
+    // Awaiter resuming with the arguments of the next emission.
+    class Next : private Node {
+       public:
+        explicit Next(Emission_waiters& waiters) { this->owner = &waiters; }
+
+        Next(Next const&) = delete;
+
+        auto operator=(Next const&) -> Next& = delete;
+
+        ~Next()
+        {
+            if (this->owner != nullptr)
+                this->owner->detach(*this);
+        }
+
+       public:
+        auto await_ready() const noexcept -> bool { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            this->handle = handle;
+            this->owner->attach(*this);
+        }
+
+        auto await_resume() -> Tuple { return std::move(*result_); }
+
+       private:
+        std::optional<Tuple> result_;
+
+       private:
+        auto deliver(Tuple const& args) -> std::coroutine_handle<> override
+        {
+            result_.emplace(args);
+            return std::exchange(this->handle, {});
+        }
+    };
+
+    // Registered for its whole lifetime, buffers every emission until it is
+    // taken by awaiting next().
+    class Stream : private Node {
+       public:
+        class Awaiter {
+           public:
+            explicit Awaiter(Stream& stream) : stream_{&stream} {}
+
+            auto await_ready() const noexcept -> bool { return false; }
+
+            auto await_suspend(std::coroutine_handle<> handle) -> bool
+            {
+                return stream_->suspend(handle);
+            }
+
+            auto await_resume() -> Tuple { return stream_->take(); }
+
+           private:
+            Stream* stream_;
+        };
+
+       public:
+        explicit Stream(Emission_waiters& waiters)
+        {
+            this->persistent = true;
+            this->owner      = &waiters;
+            waiters.attach(*this);
+        }
+
+        Stream(Stream const&) = delete;
+
+        auto operator=(Stream const&) -> Stream& = delete;
+
+        ~Stream()
+        {
+            if (this->owner != nullptr)
+                this->owner->detach(*this);
+        }
+
+       public:
+        auto next() -> Awaiter { return Awaiter{*this}; }
+
+       private:
+        std::deque<Tuple> buffer_;
+
+       private:
+        auto deliver(Tuple const& args) -> std::coroutine_handle<> override
+        {
+            buffer_.push_back(args);
+            return std::exchange(this->handle, {});
+        }
+
+        // Suspends unless an emission is already buffered.
+        auto suspend(std::coroutine_handle<> handle) -> bool
+        {
+            if (this->owner == nullptr)
+                return buffer_.empty();
+            auto const lock = Lock_t{this->owner->mtx_};
+            if (!buffer_.empty())
+                return false;
+            this->handle = handle;
+            return true;
+        }
+
+        auto take() -> Tuple
+        {
+            auto const take_front = [this] {
+                auto front = std::move(buffer_.front());
+                buffer_.pop_front();
+                return front;
+            };
+            if (this->owner == nullptr)
+                return take_front();
+            auto const lock = Lock_t{this->owner->mtx_};
+            return take_front();
+        }
+    };
+
+   public:
+    Emission_waiters() = default;
+
+    Emission_waiters(Emission_waiters const&) = delete;
+
+    auto operator=(Emission_waiters const&) -> Emission_waiters& = delete;
+
+    // Waiters left are never resumed, their owner is cleared so that they can
+    // still be destroyed.
+    ~Emission_waiters()
+    {
+        auto const lock = Lock_t{mtx_};
+        for (auto* node = head_; node != nullptr; node = node->next)
+            node->owner = nullptr;
+    }
+
+   public:
+    // Appends the waiters of \p other, which is left without any, so that
+    // they are resumed by emissions of the Signal owning *this from now on.
+    void take(Emission_waiters& other)
+    {
+        auto const lock = std::scoped_lock<Mutex, Mutex>{mtx_, other.mtx_};
+        this->splice(other);
+    }
+
+    // take() into a *this no other thread can reach yet, from the move
+    // constructor of its Signal. Only the lock of \p other is taken.
+    void take_new(Emission_waiters& other)
+    {
+        auto const lock = Lock_t{other.mtx_};
+        this->splice(other);
+    }
+
+    // Hands \p args to every waiter and resumes the suspended ones.
+    template <typename... Params>
+    void notify(Params&... args)
+    {
+        if (count_.load(std::memory_order_relaxed) == 0)
+            return;
+        auto ready = std::vector<std::coroutine_handle<>>{};
+        {
+            auto const lock = Lock_t{mtx_};
+            if (head_ == nullptr)
+                return;
+            auto const copy = Tuple{args...};
+            ready.reserve(count_.load(std::memory_order_relaxed));
+            for (auto* node = head_; node != nullptr;) {
+                auto* const next  = node->next;
+                auto const handle = node->deliver(copy);
+                if (!node->persistent) {
+                    this->unlink(*node);
+                    node->owner = nullptr;
+                }
+                if (handle)
+                    ready.push_back(handle);
+                node = next;
+            }
+        }
+        for (auto const handle : ready)
+            handle.resume();
+    }
+
+   private:
+    Node* head_ = nullptr;
+    Node* tail_ = nullptr;
+    typename Threading::template Atomic<std::size_t> count_ = 0;
+    Mutex mtx_;
+
+   private:
+    void attach(Node& node)
+    {
+        auto const lock = Lock_t{mtx_};
+        node.prev       = tail_;
+        node.next       = nullptr;
+        if (tail_ != nullptr)
+            tail_->next = &node;
+        else
+            head_ = &node;
+        tail_ = &node;
+        count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void detach(Node& node)
+    {
+        auto const lock = Lock_t{mtx_};
+        if (this->linked(node))
+            this->unlink(node);
+        node.owner = nullptr;
+    }
+
+    // Moves the waiters of \p other to the end of *this, with the locks the
+    // caller needs already held.
+    void splice(Emission_waiters& other)
+    {
+        if (other.head_ == nullptr)
+            return;
+        for (auto* node = other.head_; node != nullptr; node = node->next)
+            node->owner = this;
+        other.head_->prev = tail_;
+        (tail_ != nullptr ? tail_->next : head_) = other.head_;
+        tail_ = std::exchange(other.tail_, nullptr);
+        other.head_ = nullptr;
+        count_.fetch_add(other.count_.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+        other.count_.store(0, std::memory_order_relaxed);
+    }
+
+    auto linked(Node const& node) const -> bool
+    {
+        return node.prev != nullptr || head_ == &node;
+    }
+
+    void unlink(Node& node)
+    {
+        (node.prev != nullptr ? node.prev->next : head_) = node.next;
+        (node.next != nullptr ? node.next->prev : tail_) = node.prev;
+        node.prev = nullptr;
+        node.next = nullptr;
+        count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+}  // namespace sig
+#endif
+#endif  // SIGNALS_DETAIL_EMISSION_WAITERS_HPP
@@ -0,0 +1,166 @@
+#ifndef SIGNALS_DETAIL_EPOCH_SNAPSHOT_HPP
+#define SIGNALS_DETAIL_EPOCH_SNAPSHOT_HPP
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace sig {
+
+// Publishes immutable versions of a T to readers that take no reference
+// count. A reader enters the current epoch by incrementing that epoch's
+// reader count, reads the current version and leaves by decrementing the
+// count again, walking the version in place in between. A version replaced by
+// publish() is retired, tagged with the epoch it was replaced in, and
+// destroyed once the epoch has moved two past that tag. The epoch only moves
+// from e to e + 1 while no reader that entered epoch e - 1 is left, so by the
+// time a version is destroyed every reader that could have read it has left.
+// Readers never wait, so a reader may publish from within its read section,
+// a Slot connecting or disconnecting during an emission for example, and
+// keeps reading the version it started with. publish(), take(), release(),
+// collect() and get() must be called under the owner's lock.
+template <typename T, typename Threading>
+class Epoch_snapshot {
+   public:
+    // Read section of the version current when it was constructed, which is
+    // kept alive until the Reader is destroyed.
+    class Reader {
+       public:
+        explicit Reader(Epoch_snapshot const& snapshot)
+            : snapshot_{&snapshot},
+              parity_{snapshot.enter()},
+              state_{snapshot.current_.load(std::memory_order_seq_cst)}
+        {}
+
+        Reader(Reader const&) = delete;
+
+        auto operator=(Reader const&) -> Reader& = delete;
+
+        ~Reader() { snapshot_->leave(parity_); }
+
+       public:
+        // nullptr if nothing was published.
+        auto get() const -> T const* { return state_; }
+
+       private:
+        Epoch_snapshot const* snapshot_;
+        std::size_t parity_;
+        T const* state_;
+    };
+
+   public:
+    Epoch_snapshot() = default;
+
+    Epoch_snapshot(Epoch_snapshot const&) = delete;
+
+    auto operator=(Epoch_snapshot const&) -> Epoch_snapshot& = delete;
+
+   public:
+    // Makes \p next the version read from now on, retiring the previous one.
+    void publish(std::shared_ptr<T const> next)
+    {
+        // Room first, a version readers may hold must never be dropped.
+        if (owner_ != nullptr && retired_.size() == retired_.capacity())
+            retired_.reserve(std::max(retired_.size() * 2, std::size_t{4}));
+        current_.store(next.get(), std::memory_order_seq_cst);
+        auto previous = std::exchange(owner_, std::move(next));
+        if (previous != nullptr) {
+            retired_.push_back(
+                {epoch_.load(std::memory_order_relaxed), std::move(previous)});
+        }
+        this->collect();
+    }
+
+    // Takes over the current version of \p other, which is left unpublished.
+    // *this must never have published, so nothing is retired and nothing is
+    // allocated.
+    void take(Epoch_snapshot& other) noexcept
+    {
+        owner_ = other.release();
+        current_.store(owner_.get(), std::memory_order_seq_cst);
+    }
+
+    // Unpublishes the current version and returns it. Readers may still hold
+    // it, so it must be published elsewhere rather than dropped.
+    auto release() noexcept -> std::shared_ptr<T const>
+    {
+        current_.store(nullptr, std::memory_order_seq_cst);
+        return std::exchange(owner_, nullptr);
+    }
+
+    // Moves the epoch on as far as readers allow, then destroys the retired
+    // versions no reader can hold anymore.
+    void collect()
+    {
+        for (auto i = 0; i < 2; ++i) {
+            auto const epoch = epoch_.load(std::memory_order_relaxed);
+            if (readers_[(epoch + 1) % 2].load(std::memory_order_seq_cst) != 0)
+                break;
+            epoch_.store(epoch + 1, std::memory_order_seq_cst);
+        }
+        auto const epoch = epoch_.load(std::memory_order_relaxed);
+        auto const freed = [epoch](auto const& r) {
+            return r.epoch + 2 <= epoch;
+        };
+        retired_.erase(
+            std::remove_if(std::begin(retired_), std::end(retired_), freed),
+            std::end(retired_));
+        has_retired_.store(!retired_.empty(), std::memory_order_relaxed);
+    }
+
+    // The current version, nullptr if nothing is published.
+    auto get() const -> T const* { return owner_.get(); }
+
+    // Query whether a version is published, without entering a read section.
+    auto published() const -> bool
+    {
+        return current_.load(std::memory_order_acquire) != nullptr;
+    }
+
+    // Query whether retired versions are waiting for collect(), without the
+    // owner's lock.
+    auto has_retired() const -> bool
+    {
+        return has_retired_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    template <typename U>
+    using Atomic = typename Threading::template Atomic<U>;
+
+    struct Retired {
+        std::uint64_t epoch;
+        std::shared_ptr<T const> state;
+    };
+
+    // Written by every reader, kept apart from what readers only load.
+    alignas(64) mutable Atomic<std::size_t> readers_[2] = {0, 0};
+    alignas(64) Atomic<T const*> current_               = nullptr;
+    Atomic<std::uint64_t> epoch_                        = 0;
+    Atomic<bool> has_retired_                           = false;
+    std::shared_ptr<T const> owner_;
+    std::vector<Retired> retired_;
+
+   private:
+    // Registers a reader with the current epoch, returns the parity of the
+    // reader count it incremented. The epoch read may already be stale, the
+    // increment still holds back any epoch change that could free a version
+    // read after it.
+    auto enter() const -> std::size_t
+    {
+        auto const parity = epoch_.load(std::memory_order_relaxed) % 2;
+        readers_[parity].fetch_add(1, std::memory_order_seq_cst);
+        return parity;
+    }
+
+    void leave(std::size_t parity) const
+    {
+        readers_[parity].fetch_sub(1, std::memory_order_release);
+    }
+};
+
+}  // namespace sig
+#endif  // SIGNALS_DETAIL_EPOCH_SNAPSHOT_HPP
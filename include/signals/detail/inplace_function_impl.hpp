@@ -0,0 +1,209 @@
+#ifndef SIGNALS_DETAIL_INPLACE_FUNCTION_IMPL_HPP
+#define SIGNALS_DETAIL_INPLACE_FUNCTION_IMPL_HPP
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sig {
+
+// True if an F can be called with the signature of an Inplace_function_impl.
+template <bool Noexcept, typename F, typename R, typename... Args>
+inline constexpr bool is_inplace_callable_v =
+    Noexcept ? std::is_nothrow_invocable_r_v<R, F&, Args...>
+             : std::is_invocable_r_v<R, F&, Args...>;
+
+// Implements Inplace_function for both the plain and the noexcept call
+// signature. The stored callable lives in buffer_ when it fits and is nothrow
+// move constructible, otherwise buffer_ holds a pointer to a heap allocated
+// callable. A static table of function pointers per callable type does the
+// type erasure, an empty function has a null table.
+template <bool Noexcept, std::size_t Capacity, typename R, typename... Args>
+class Inplace_function_impl {
+    static_assert(Capacity >= sizeof(void*),
+                  "Inplace_function capacity must be able to hold a pointer.");
+
+   public:
+    using result_type = R;
+
+   public:
+    Inplace_function_impl() = default;
+
+    Inplace_function_impl(std::nullptr_t) {}
+
+    /// Stores \p f, inline if it fits, otherwise on the heap.
+    template <typename F,
+              typename = std::enable_if_t<
+                  !std::is_base_of_v<Inplace_function_impl, std::decay_t<F>> &&
+                  is_inplace_callable_v<Noexcept, std::decay_t<F>, R, Args...>>>
+    Inplace_function_impl(F&& f)
+    {
+        this->emplace<std::decay_t<F>>(std::forward<F>(f));
+    }
+
+    Inplace_function_impl(Inplace_function_impl const&) = delete;
+
+    Inplace_function_impl(Inplace_function_impl&& other) noexcept
+        : table_{other.table_}
+    {
+        if (table_ != nullptr) {
+            table_->relocate(&buffer_, &other.buffer_);
+            other.table_ = nullptr;
+        }
+    }
+
+    auto operator=(Inplace_function_impl const&)
+        -> Inplace_function_impl& = delete;
+
+    auto operator=(Inplace_function_impl&& other) noexcept
+        -> Inplace_function_impl&
+    {
+        if (this != &other) {
+            this->reset();
+            if (other.table_ != nullptr) {
+                other.table_->relocate(&buffer_, &other.buffer_);
+                table_       = other.table_;
+                other.table_ = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    auto operator=(std::nullptr_t) -> Inplace_function_impl&
+    {
+        this->reset();
+        return *this;
+    }
+
+    template <typename F,
+              typename = std::enable_if_t<
+                  !std::is_base_of_v<Inplace_function_impl, std::decay_t<F>> &&
+                  is_inplace_callable_v<Noexcept, std::decay_t<F>, R, Args...>>>
+    auto operator=(F&& f) -> Inplace_function_impl&
+    {
+        return *this = Inplace_function_impl{std::forward<F>(f)};
+    }
+
+    ~Inplace_function_impl() { this->reset(); }
+
+   public:
+    /// Call the stored callable, throws std::bad_function_call if empty.
+    /** A noexcept signature calls std::terminate instead of throwing. */
+    auto operator()(Args... args) const noexcept(Noexcept) -> R
+    {
+        if (table_ == nullptr) {
+            if constexpr (Noexcept)
+                std::terminate();
+            else
+                throw std::bad_function_call{};
+        }
+        return table_->invoke(&buffer_, std::forward<Args>(args)...);
+    }
+
+    /// \returns True if a callable is stored.
+    explicit operator bool() const noexcept { return table_ != nullptr; }
+
+    friend auto operator==(Inplace_function_impl const& f, std::nullptr_t)
+        -> bool
+    {
+        return !f;
+    }
+
+    friend auto operator==(std::nullptr_t, Inplace_function_impl const& f)
+        -> bool
+    {
+        return !f;
+    }
+
+    friend auto operator!=(Inplace_function_impl const& f, std::nullptr_t)
+        -> bool
+    {
+        return bool(f);
+    }
+
+    friend auto operator!=(std::nullptr_t, Inplace_function_impl const& f)
+        -> bool
+    {
+        return bool(f);
+    }
+
+   private:
+    struct Table {
+        R (*invoke)(void* storage, Args&&... args);
+        void (*relocate)(void* to, void* from) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template <typename F>
+    static constexpr bool stored_inline =
+        sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F>
+    static auto target(void* storage) -> F*
+    {
+        if constexpr (stored_inline<F>)
+            return std::launder(static_cast<F*>(storage));
+        else
+            return *static_cast<F**>(storage);
+    }
+
+    template <typename F>
+    static constexpr auto table_for = Table{
+        [](void* storage, Args&&... args) -> R {
+            if constexpr (std::is_void_v<R>)
+                std::invoke(*target<F>(storage), std::forward<Args>(args)...);
+            else {
+                return std::invoke(*target<F>(storage),
+                                   std::forward<Args>(args)...);
+            }
+        },
+        [](void* to, void* from) noexcept {
+            if constexpr (stored_inline<F>) {
+                ::new (to) F(std::move(*target<F>(from)));
+                target<F>(from)->~F();
+            }
+            else
+                ::new (to) F*(target<F>(from));
+        },
+        [](void* storage) noexcept {
+            if constexpr (stored_inline<F>)
+                target<F>(storage)->~F();
+            else
+                delete target<F>(storage);
+        }};
+
+   private:
+    alignas(std::max_align_t) mutable unsigned char buffer_[Capacity];
+    Table const* table_ = nullptr;
+
+   private:
+    template <typename F, typename Arg>
+    void emplace(Arg&& f)
+    {
+        if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>) {
+            if (f == nullptr)
+                return;
+        }
+        if constexpr (stored_inline<F>)
+            ::new (static_cast<void*>(&buffer_)) F(std::forward<Arg>(f));
+        else {
+            auto* const heap = new F(std::forward<Arg>(f));
+            ::new (static_cast<void*>(&buffer_)) F*(heap);
+        }
+        table_ = &table_for<F>;
+    }
+
+    void reset() noexcept
+    {
+        if (table_ != nullptr) {
+            table_->destroy(&buffer_);
+            table_ = nullptr;
+        }
+    }
+};
+
+}  // namespace sig
+#endif  // SIGNALS_DETAIL_INPLACE_FUNCTION_IMPL_HPP
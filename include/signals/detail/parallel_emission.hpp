@@ -0,0 +1,230 @@
+#ifndef SIGNALS_DETAIL_PARALLEL_EMISSION_HPP
+#define SIGNALS_DETAIL_PARALLEL_EMISSION_HPP
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sig {
+
+// Results of the Slots called by one parallel or slot-major batch emission,
+// one entry per connection and emission in call order, so that the Combiner
+// sees them in the same order as a serial emission regardless of which Slot
+// finished first. Each entry is written by exactly one thread. For a void Ret
+// each entry only records whether the Slot was called, for a reference Ret it
+// points to the referenced object, null if the Slot was not called.
+template <typename Ret>
+class Result_buffer {
+    using Entry = std::conditional_t<
+        std::is_void_v<Ret>,
+        char,
+        std::conditional_t<std::is_reference_v<Ret>,
+                           std::remove_reference_t<Ret>*,
+                           std::optional<Ret>>>;
+
+   public:
+    // Input iterator over the entries of Slots that were called.
+    class Iterator {
+       public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type =
+            std::remove_cv_t<std::remove_reference_t<Ret>>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::add_lvalue_reference_t<Ret const>;
+
+       public:
+        Iterator() = default;
+
+        Iterator(typename std::vector<Entry>::const_iterator iter,
+                 typename std::vector<Entry>::const_iterator last)
+            : iter_{iter}, last_{last}
+        {
+            this->skip_empty();
+        }
+
+       public:
+        auto operator*() const -> reference
+        {
+            if constexpr (!std::is_void_v<Ret>)
+                return **iter_;
+        }
+
+        auto operator++() -> Iterator&
+        {
+            ++iter_;
+            this->skip_empty();
+            return *this;
+        }
+
+        auto operator==(Iterator const& x) const -> bool
+        {
+            return iter_ == x.iter_;
+        }
+
+        auto operator!=(Iterator const& x) const -> bool
+        {
+            return !operator==(x);
+        }
+
+       private:
+        typename std::vector<Entry>::const_iterator iter_;
+        typename std::vector<Entry>::const_iterator last_;
+
+       private:
+        void skip_empty()
+        {
+            while (iter_ != last_ && !*iter_)
+                ++iter_;
+        }
+    };
+
+   public:
+    explicit Result_buffer(std::size_t size) : entries_(size) {}
+
+   public:
+    // Calls \p slot and stores its result at \p index.
+    template <typename F>
+    void emplace(std::size_t index, F&& slot)
+    {
+        if constexpr (std::is_void_v<Ret>) {
+            std::forward<F>(slot)();
+            entries_[index] = true;
+        }
+        else if constexpr (std::is_reference_v<Ret>) {
+            auto&& result   = std::forward<F>(slot)();
+            entries_[index] = std::addressof(result);
+        }
+        else
+            entries_[index].emplace(std::forward<F>(slot)());
+    }
+
+    auto begin() const -> Iterator
+    {
+        return {std::cbegin(entries_), std::cend(entries_)};
+    }
+
+    auto end() const -> Iterator
+    {
+        return {std::cend(entries_), std::cend(entries_)};
+    }
+
+    // Iterators over the entries in [first, last).
+    auto range(std::size_t first, std::size_t last) const
+        -> std::pair<Iterator, Iterator>
+    {
+        auto const end = std::cbegin(entries_) + last;
+        return {{std::cbegin(entries_) + first, end}, {end, end}};
+    }
+
+   private:
+    std::vector<Entry> entries_;
+};
+
+// State of one phase shared with the helper tasks of run_parallel. Helpers
+// may start after the phase is over, so they own this through a shared_ptr
+// and only touch the caller's job after claiming an index.
+class Parallel_phase {
+   public:
+    template <typename Job>
+    Parallel_phase(std::size_t count, Job& job)
+        : count_{count},
+          remaining_{count},
+          job_{&job},
+          call_{[](void* j, std::size_t i) { (*static_cast<Job*>(j))(i); }}
+    {}
+
+   public:
+    // Claims and runs indices until none are left.
+    void work()
+    {
+        for (auto i = next_.fetch_add(1); i < count_; i = next_.fetch_add(1)) {
+            try {
+                call_(job_, i);
+            }
+            catch (...) {
+                auto const lock = std::scoped_lock{mtx_};
+                if (error_ == nullptr)
+                    error_ = std::current_exception();
+            }
+            if (remaining_.fetch_sub(1) == 1) {
+                { auto const lock = std::scoped_lock{mtx_}; }
+                done_.notify_all();
+            }
+        }
+    }
+
+    // Blocks until every index has run, then rethrows the first exception.
+    void wait()
+    {
+        auto lock = std::unique_lock{mtx_};
+        done_.wait(lock, [this] { return remaining_ == 0; });
+        if (error_ != nullptr)
+            std::rethrow_exception(error_);
+    }
+
+   private:
+    std::size_t const count_;
+    std::atomic<std::size_t> next_ = 0;
+    std::atomic<std::size_t> remaining_;
+    void* job_;
+    void (*call_)(void*, std::size_t);
+    std::mutex mtx_;
+    std::condition_variable done_;
+    std::exception_ptr error_;
+};
+
+template <typename Executor, typename = void>
+struct Has_size : std::false_type {};
+
+template <typename Executor>
+struct Has_size<Executor,
+                std::void_t<decltype(std::declval<Executor const&>().size())>>
+    : std::true_type {};
+
+// Number of threads \p executor runs tasks on, its size() if it has one, such
+// as Thread_pool, the hardware concurrency otherwise.
+template <typename Executor>
+auto executor_threads(Executor const& executor) -> std::size_t
+{
+    if constexpr (Has_size<Executor>::value)
+        return std::max(static_cast<std::size_t>(executor.size()),
+                        std::size_t{1});
+    else
+        return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// Calls job(i) for each i in [0, count) on \p executor and on the calling
+// thread, returning once all calls have returned. Indices are claimed one at
+// a time, so a slow call does not hold up the others queued behind it. If any
+// call throws, the rest still run and the first exception is rethrown. At
+// most one helper task per executor thread is posted, more would only wait
+// in its queue.
+template <typename Executor, typename Job>
+void run_parallel(Executor& executor, std::size_t count, Job& job)
+{
+    if (count == 0)
+        return;
+    if (count == 1) {
+        job(std::size_t{0});
+        return;
+    }
+    auto const phase   = std::make_shared<Parallel_phase>(count, job);
+    auto const helpers = std::min(count - 1, executor_threads(executor));
+    for (auto i = std::size_t{0}; i < helpers; ++i)
+        executor.execute([phase] { phase->work(); });
+    phase->work();
+    phase->wait();
+}
+
+}  // namespace sig
+#endif  // SIGNALS_DETAIL_PARALLEL_EMISSION_HPP
@@ -1,45 +1,173 @@
 #ifndef SIGNALS_DETAIL_SLOT_ITERATOR_HPP
 #define SIGNALS_DETAIL_SLOT_ITERATOR_HPP
+#include <cstddef>
 #include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../move_only_arguments.hpp"
+#include "slot_recorder.hpp"
 
 namespace sig {
 
-// Slot_iterator points to a functor object, when it is dereferenced you get a
-// function type object that is callable with no arguments. The iterator is
-// useful for iterating over a container of functions and calling each function
-// on a dereference operation. InputIterator is any container iterator that
-// holds a callable type and can be incremented, dereferenced and copied.
-template <typename InputIterator>
+// Slot_iterator walks a range of Connection_impl pointers, when it is
+// dereferenced the Slot of the current connection is called with the bound
+// arguments. The arguments are held by reference in a tuple owned by the
+// caller, so no per-Slot closure is created. Connections that are
+// disconnected, blocked or have expired tracked objects are skipped when the
+// iterator is constructed or incremented, so a Slot disconnected by an earlier
+// Slot in the same emission is never called. Tracked objects are checked and
+// locked in a single pass when the iterator reaches a Slot, and held until it
+// moves on, the Slot is then called without checking them again. Each disconnected or expired
+// connection passed over is counted in a caller owned counter, so the Signal
+// knows when it is worth reclaiming them. InputIterator is any iterator whose
+// value type can be dereferenced to a Connection_impl.
+//
+// With Forward set, Bound_args holds forwarding references, and the last Slot
+// that can be called when the iterator is constructed receives the rvalue
+// arguments as rvalues, every other Slot receives lvalues. The last Slot is
+// found once, scanning back from the end, and the iterator moves to the end
+// after it, so no Slot unblocked during the emission sees the arguments moved
+// from. If the arguments cannot be copied and more than one Slot can be
+// called, the constructor throws Move_only_arguments.
+template <typename InputIterator, typename Bound_args, bool Forward = false>
 class Slot_iterator {
    public:
-    using Iter_value_t =
-        typename std::iterator_traits<InputIterator>::value_type;
-    using Result_t = typename Iter_value_t::result_type;
+    using Impl =
+        std::remove_reference_t<decltype(**std::declval<InputIterator>())>;
+    using Result_t = typename Impl::Result_t;
+    using Value_t  = std::remove_cv_t<std::remove_reference_t<Result_t>>;
+    using Pin      = typename Impl::Slot_t::Pin;
+
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = Value_t;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = Result_t;
 
    public:
     Slot_iterator() = default;
 
-    explicit Slot_iterator(InputIterator iter) : iter_{iter} {}
+    Slot_iterator(InputIterator iter,
+                  InputIterator last,
+                  Bound_args const& args,
+                  std::size_t& dead_count)
+        : iter_{iter},
+          last_{last},
+          final_{last},
+          args_{&args},
+          dead_count_{&dead_count}
+    {
+        this->skip_unusable();
+        if constexpr (Forward) {
+            this->find_final();
+            if constexpr (!Impl::copyable_arguments) {
+                if (iter_ != final_)
+                    throw Move_only_arguments();
+            }
+        }
+    }
 
    public:
-    auto operator*() -> Result_t
+    auto operator*() const -> Result_t
     {
-        auto slot = *iter_;
-        return slot();
+        if constexpr (Forward) {
+            if (iter_ == final_)
+                return (*iter_)->call_forwarding(*args_);
+            if constexpr (!Impl::copyable_arguments)
+                throw Move_only_arguments();
+            else
+                return (*iter_)->call_pinned(*args_);
+        }
+        else
+            return (*iter_)->call_pinned(*args_);
     }
 
     auto operator++() -> Slot_iterator&
     {
+        pin_.reset();
+        if (Forward && iter_ == final_) {
+            iter_ = last_;
+            return *this;
+        }
         ++iter_;
+        this->skip_unusable();
         return *this;
     }
 
-    auto operator==(Slot_iterator const& x) -> bool { return iter_ == x.iter_; }
+    auto operator==(Slot_iterator const& x) const -> bool
+    {
+        return iter_ == x.iter_;
+    }
 
-    auto operator!=(Slot_iterator const& x) -> bool { return !operator==(x); }
+    auto operator!=(Slot_iterator const& x) const -> bool
+    {
+        return !operator==(x);
+    }
 
    private:
     InputIterator iter_;
+    InputIterator last_;
+    InputIterator final_;  // Last Slot called with Forward set.
+    Bound_args const* args_  = nullptr;
+    std::size_t* dead_count_ = nullptr;
+    std::optional<Pin> pin_;  // Tracked objects of the Slot at iter_.
+
+   private:
+    // Advance iter_ to the next connection that can currently be called, or
+    // to the end once final_ is passed over.
+    void skip_unusable()
+    {
+        auto const expired = [this](auto const& slot) {
+            return !slot.get_tracked_container().empty() &&
+                   !pin_.emplace(slot.pin());
+        };
+        for (; iter_ != last_; ++iter_) {
+            if (this->usable(*iter_, expired))
+                return;
+            if (Forward && iter_ == final_) {
+                iter_ = last_;
+                return;
+            }
+        }
+    }
+
+    // Points final_ to the last connection that can currently be called,
+    // counting the ones after it as skipped, they are never reached.
+    void find_final()
+    {
+        auto const expired = [](auto const& slot) { return slot.expired(); };
+        for (auto back = last_; back != iter_;) {
+            --back;
+            if (this->usable(*back, expired)) {
+                final_ = back;
+                return;
+            }
+        }
+    }
+
+    // Query whether \p connection can be called, if not it is counted as
+    // skipped. \p expired checks the tracked objects of its Slot.
+    template <typename Connection_ptr, typename Expired>
+    auto usable(Connection_ptr const& connection, Expired const& expired) const
+        -> bool
+    {
+        if (!connection->connected()) {
+            ++*dead_count_;
+            connection->skipped(Skip_reason::disconnected);
+        }
+        else if (expired(connection->get_slot())) {
+            ++*dead_count_;
+            connection->skipped(Skip_reason::expired);
+        }
+        else if (connection->blocked())
+            connection->skipped(Skip_reason::blocked);
+        else
+            return true;
+        return false;
+    }
 };
 
 }  // namespace sig
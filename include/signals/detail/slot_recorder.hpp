@@ -0,0 +1,114 @@
+#ifndef SIGNALS_DETAIL_SLOT_RECORDER_HPP
+#define SIGNALS_DETAIL_SLOT_RECORDER_HPP
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "../stats.hpp"
+
+namespace sig {
+
+// Why an emission passed over a connection.
+enum class Skip_reason { blocked, disconnected, expired };
+
+#ifdef SIGNALS_ENABLE_STATS
+
+// Counters of one connection, updated by every emission that comes across it.
+// Each update is a single relaxed increment, with the Single_threaded policy a
+// plain one. Only compiled with SIGNALS_ENABLE_STATS.
+template <typename Threading>
+class Slot_recorder {
+   public:
+    // Calls \p call, counting it and its duration, also if it throws.
+    template <typename F>
+    auto time(F&& call) -> decltype(auto)
+    {
+        struct Stop {
+            Slot_recorder& recorder;
+            std::chrono::steady_clock::time_point start;
+
+            ~Stop()
+            {
+                recorder.record(std::chrono::steady_clock::now() - start);
+            }
+        };
+        auto const stop = Stop{*this, std::chrono::steady_clock::now()};
+        return std::forward<F>(call)();
+    }
+
+    void skip(Skip_reason reason, std::uint64_t count)
+    {
+        auto& counter = reason == Skip_reason::blocked        ? blocked_
+                        : reason == Skip_reason::disconnected ? disconnected_
+                                                              : expired_;
+        counter.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    // Counters read one at a time, so a snapshot taken during an emission may
+    // be off by the calls in flight.
+    auto snapshot() const -> Slot_stats
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+
+        auto stats                 = Slot_stats{};
+        stats.invoked              = invoked_.load(relaxed);
+        stats.skipped_blocked      = blocked_.load(relaxed);
+        stats.skipped_disconnected = disconnected_.load(relaxed);
+        stats.skipped_expired      = expired_.load(relaxed);
+        for (auto i = std::size_t{0}; i < buckets_.size(); ++i)
+            stats.latency.buckets[i] = buckets_[i].load(relaxed);
+        return stats;
+    }
+
+    void reset()
+    {
+        invoked_.store(0, std::memory_order_relaxed);
+        blocked_.store(0, std::memory_order_relaxed);
+        disconnected_.store(0, std::memory_order_relaxed);
+        expired_.store(0, std::memory_order_relaxed);
+        for (auto& bucket : buckets_)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+
+   private:
+    using Counter = typename Threading::template Atomic<std::uint64_t>;
+
+    Counter invoked_      = 0;
+    Counter blocked_      = 0;
+    Counter disconnected_ = 0;
+    Counter expired_      = 0;
+    std::array<Counter, Latency_histogram::bucket_count> buckets_ = {};
+
+   private:
+    void record(std::chrono::steady_clock::duration elapsed)
+    {
+        invoked_.fetch_add(1, std::memory_order_relaxed);
+        auto const ns = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count());
+        buckets_[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Index of the highest set bit of \p ns, clamped to the last bucket.
+    static auto bucket_of(std::uint64_t ns) -> std::size_t
+    {
+        auto log2 = std::size_t{0};
+#if defined(__GNUC__) || defined(__clang__)
+        if (ns != 0)
+            log2 = 63 - static_cast<std::size_t>(__builtin_clzll(ns));
+#else
+        while (ns >>= 1)
+            ++log2;
+#endif
+        return log2 < Latency_histogram::bucket_count
+                   ? log2
+                   : Latency_histogram::bucket_count - 1;
+    }
+};
+
+#endif
+
+}  // namespace sig
+#endif  // SIGNALS_DETAIL_SLOT_RECORDER_HPP
@@ -0,0 +1,81 @@
+#ifndef SIGNALS_DETAIL_STATIC_SLOT_ITERATOR_HPP
+#define SIGNALS_DETAIL_STATIC_SLOT_ITERATOR_HPP
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+namespace sig {
+
+// Static_slot_iterator walks a tuple of Slot objects by index, when it is
+// dereferenced the Slot at the current index is called with the bound
+// arguments. The index is matched against each position in turn by a chain of
+// if constexpr calls, rather than a table of function pointers, so every Slot
+// call can be inlined into the Combiner and a loop over a known number of
+// Slots can be unrolled into direct calls. Slots is a possibly const
+// std::tuple, Ret is the Signal's return type.
+template <typename Ret, typename Slots, typename Bound_args>
+class Static_slot_iterator {
+    static constexpr auto size = std::tuple_size_v<std::remove_const_t<Slots>>;
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = Ret;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = Ret;
+
+   public:
+    Static_slot_iterator() = default;
+
+    Static_slot_iterator(Slots& slots,
+                         Bound_args const& args,
+                         std::size_t index)
+        : slots_{&slots}, args_{&args}, index_{index}
+    {}
+
+   public:
+    auto operator*() const -> Ret { return this->call<0>(); }
+
+    auto operator++() -> Static_slot_iterator&
+    {
+        ++index_;
+        return *this;
+    }
+
+    auto operator==(Static_slot_iterator const& x) const -> bool
+    {
+        return index_ == x.index_;
+    }
+
+    auto operator!=(Static_slot_iterator const& x) const -> bool
+    {
+        return !operator==(x);
+    }
+
+   private:
+    Slots* slots_           = nullptr;
+    Bound_args const* args_ = nullptr;
+    std::size_t index_      = 0;
+
+   private:
+    // Calls the Slot at index_, which is at least I.
+    template <std::size_t I>
+    auto call() const -> Ret
+    {
+        if constexpr (size == 0)
+            std::terminate();
+        else if constexpr (I + 1 == size)
+            return static_cast<Ret>(std::apply(std::get<I>(*slots_), *args_));
+        else {
+            if (index_ == I)
+                return static_cast<Ret>(
+                    std::apply(std::get<I>(*slots_), *args_));
+            return this->call<I + 1>();
+        }
+    }
+};
+
+}  // namespace sig
+#endif  // SIGNALS_DETAIL_STATIC_SLOT_ITERATOR_HPP
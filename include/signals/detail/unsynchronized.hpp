@@ -0,0 +1,74 @@
+#ifndef SIGNALS_DETAIL_UNSYNCHRONIZED_HPP
+#define SIGNALS_DETAIL_UNSYNCHRONIZED_HPP
+#include <atomic>
+#include <utility>
+
+namespace sig {
+
+// Stand-in for std::atomic<T> with plain reads and writes, used by the
+// Single_threaded policy. Memory order arguments are accepted and ignored so
+// code can be written once against either type.
+template <typename T>
+class Unsynchronized {
+   public:
+    Unsynchronized() = default;
+
+    Unsynchronized(T value) : value_{std::move(value)} {}
+
+    Unsynchronized(Unsynchronized const&) = delete;
+
+    auto operator=(Unsynchronized const&) -> Unsynchronized& = delete;
+
+    auto operator=(T value) -> T
+    {
+        value_ = value;
+        return value_;
+    }
+
+    operator T() const { return value_; }
+
+   public:
+    auto load(std::memory_order = std::memory_order_seq_cst) const -> T
+    {
+        return value_;
+    }
+
+    void store(T value, std::memory_order = std::memory_order_seq_cst)
+    {
+        value_ = std::move(value);
+    }
+
+    auto fetch_add(T arg, std::memory_order = std::memory_order_seq_cst) -> T
+    {
+        auto const old = value_;
+        value_ += arg;
+        return old;
+    }
+
+    auto fetch_sub(T arg, std::memory_order = std::memory_order_seq_cst) -> T
+    {
+        auto const old = value_;
+        value_ -= arg;
+        return old;
+    }
+
+    auto fetch_and(T arg, std::memory_order = std::memory_order_seq_cst) -> T
+    {
+        auto const old = value_;
+        value_ &= arg;
+        return old;
+    }
+
+    auto fetch_or(T arg, std::memory_order = std::memory_order_seq_cst) -> T
+    {
+        auto const old = value_;
+        value_ |= arg;
+        return old;
+    }
+
+   private:
+    T value_ = T();
+};
+
+}  // namespace sig
+#endif  // SIGNALS_DETAIL_UNSYNCHRONIZED_HPP
@@ -0,0 +1,256 @@
+/// \file
+/// Inbox of a thread that receives Slot calls from queued connections.
+#ifndef SIGNALS_DISPATCHER_HPP
+#define SIGNALS_DISPATCHER_HPP
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "inplace_function.hpp"
+
+namespace sig {
+
+/// Runs posted tasks on whichever thread drains it.
+/** Slots connected to a Signal with a Dispatcher are not called by the
+ *  emitting thread, instead the emission posts a task holding a copy of the
+ *  arguments, and the Slot is called when the owning thread calls
+ *  run_pending(). Any number of threads may post concurrently without
+ *  locking, but only one thread at a time may drain. Tasks live in a ring of
+ *  preallocated cells, each with inline storage for task_capacity bytes, so
+ *  posting from a queued connection does not allocate unless the copied
+ *  arguments take more than argument_capacity bytes. When the ring is full,
+ *  post() waits for the draining thread to make room, unless it is called by
+ *  the thread that last drained, which cannot wait for itself and appends the
+ *  task to an overflow list instead. Until that list is drained every post()
+ *  appends to it, so tasks still run in the order they were posted. A
+ *  Dispatcher must outlive the connections made with it.
+ *  \sa Signal::connect */
+class Dispatcher {
+   public:
+    /// Bytes of a task stored inline in its ring cell.
+    static constexpr std::size_t task_capacity = 8 * sizeof(void*);
+
+    /// Bytes of arguments a queued connection's task stores inline, the rest
+    /// of task_capacity holds a shared pointer to the connection's Slot.
+    static constexpr std::size_t argument_capacity =
+        task_capacity - 2 * sizeof(void*);
+
+    /// Unit of work held in the ring.
+    using Task = Inplace_function<void(), task_capacity>;
+
+   public:
+    /// Constructs a Dispatcher holding at least \p capacity pending tasks.
+    /** \param capacity Rounded up to a power of two, at least two. */
+    explicit Dispatcher(std::size_t capacity = 1'024)
+    {
+        auto size = std::size_t{2};
+        while (size < capacity)
+            size *= 2;
+        mask_  = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (auto i = std::size_t{0}; i < size; ++i)
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    Dispatcher(Dispatcher const&) = delete;
+
+    auto operator=(Dispatcher const&) -> Dispatcher& = delete;
+
+    ~Dispatcher() = default;
+
+   public:
+    /// Queues \p task to be run by the draining thread.
+    /** Lock free unless the ring is full, in which case this yields until
+     *  there is room. If the calling thread is the one that last called
+     *  run_pending(), no other thread would make room, so \p task is appended
+     *  to the overflow list instead, which allocates. While that list holds
+     *  tasks, \p task is appended to it as well. Safe to call from any
+     *  thread. */
+    void post(Task task)
+    {
+        while (true) {
+            auto const overflowing =
+                overflowed_.load(std::memory_order_acquire) != 0;
+            if (!overflowing && this->try_post(task))
+                return;
+            if (overflowing || drainer_.load(std::memory_order_relaxed) ==
+                                   std::this_thread::get_id()) {
+                this->overflow(std::move(task));
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    /// Queues \p task if there is room, without waiting.
+    /** Does not look at the overflow list, so \p task may run ahead of tasks
+     *  that post() appended to it.
+     *  \returns True if \p task was queued, false if the ring is full, in
+     *  which case \p task is left untouched. */
+    auto try_post(Task& task) -> bool
+    {
+        auto position = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = cells_[position & mask_];
+            auto const lag =
+                static_cast<std::ptrdiff_t>(
+                    cell.sequence.load(std::memory_order_acquire)) -
+                static_cast<std::ptrdiff_t>(position);
+            if (lag == 0) {
+                if (tail_.compare_exchange_weak(position, position + 1,
+                                                std::memory_order_relaxed)) {
+                    cell.task = std::move(task);
+                    cell.sequence.store(position + 1,
+                                        std::memory_order_release);
+                    this->wake();
+                    return true;
+                }
+            }
+            else if (lag < 0)
+                return false;
+            else
+                position = tail_.load(std::memory_order_relaxed);
+        }
+    }
+
+    /// Runs every task posted before this call, on the calling thread.
+    /** Tasks posted while running are left for the next call, so a task that
+     *  posts to its own Dispatcher cannot keep this from returning. Must not be
+     *  called concurrently with itself or the wait functions.
+     *  \returns The number of tasks run. */
+    auto run_pending() -> std::size_t
+    {
+        drainer_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        auto const end  = tail_.load(std::memory_order_acquire);
+        auto overflowed = overflowed_.load(std::memory_order_acquire);
+        auto count      = std::size_t{0};
+        for (; head_ != end; ++count) {
+            auto task = Task{};
+            if (!this->try_take(task))
+                return count;
+            task();
+        }
+        // Overflowed tasks were posted after those in the ring.
+        for (; overflowed != 0; --overflowed, ++count)
+            this->take_overflowed()();
+        return count;
+    }
+
+    /// Blocks until at least one task is pending.
+    void wait()
+    {
+        if (!this->empty())
+            return;
+        auto lock = std::unique_lock{mtx_};
+        this->set_waiting(true);
+        ready_.wait(lock, [this] { return !this->empty(); });
+        this->set_waiting(false);
+    }
+
+    /// Blocks until at least one task is pending or \p timeout has passed.
+    /** \returns True if a task is pending. */
+    template <typename Rep, typename Period>
+    auto wait_for(std::chrono::duration<Rep, Period> const& timeout) -> bool
+    {
+        if (!this->empty())
+            return true;
+        auto lock = std::unique_lock{mtx_};
+        this->set_waiting(true);
+        auto const ready =
+            ready_.wait_for(lock, timeout, [this] { return !this->empty(); });
+        this->set_waiting(false);
+        return ready;
+    }
+
+    /// Query whether no task is pending, from the draining thread.
+    auto empty() const -> bool
+    {
+        auto const& cell = cells_[head_ & mask_];
+        return cell.sequence.load(std::memory_order_acquire) != head_ + 1 &&
+               overflowed_.load(std::memory_order_acquire) == 0;
+    }
+
+    /// \returns The number of tasks the ring holds.
+    auto capacity() const -> std::size_t { return mask_ + 1; }
+
+   private:
+    // A ring cell is free for the producer at position p when its sequence is
+    // p, and holds a task for the consumer at position p when it is p + 1.
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        Task task;
+    };
+
+   private:
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::size_t> tail_ = 0;
+    alignas(64) std::size_t head_ = 0;
+    std::atomic<std::thread::id> drainer_ = std::thread::id{};
+    std::atomic<bool> waiting_ = false;
+    std::mutex mtx_;
+    std::condition_variable ready_;
+    std::deque<Task> overflow_;  // Guarded by mtx_.
+    std::atomic<std::size_t> overflowed_ = 0;  // Size of overflow_.
+
+   private:
+    // Moves the task at head_ out of its cell and frees the cell.
+    auto try_take(Task& task) -> bool
+    {
+        auto& cell = cells_[head_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != head_ + 1)
+            return false;
+        task = std::move(cell.task);
+        cell.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    // Appends \p task to the overflow list, behind every task in the ring.
+    void overflow(Task task)
+    {
+        {
+            auto const lock = std::scoped_lock{mtx_};
+            overflow_.push_back(std::move(task));
+            overflowed_.store(overflow_.size(), std::memory_order_release);
+        }
+        if (waiting_.load(std::memory_order_relaxed))
+            ready_.notify_one();
+    }
+
+    // Removes the oldest task from the overflow list, which must not be
+    // empty.
+    auto take_overflowed() -> Task
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        auto task       = std::move(overflow_.front());
+        overflow_.pop_front();
+        overflowed_.store(overflow_.size(), std::memory_order_release);
+        return task;
+    }
+
+    void set_waiting(bool waiting)
+    {
+        waiting_.store(waiting);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    // Wakes a thread blocked in wait(). Only takes the mutex when one is.
+    void wake()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting_.load(std::memory_order_relaxed)) {
+            { auto const lock = std::scoped_lock{mtx_}; }
+            ready_.notify_one();
+        }
+    }
+};
+
+}  // namespace sig
+#endif  // SIGNALS_DISPATCHER_HPP
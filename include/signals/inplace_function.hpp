@@ -0,0 +1,43 @@
+#ifndef SIGNALS_INPLACE_FUNCTION_HPP
+#define SIGNALS_INPLACE_FUNCTION_HPP
+#include <cstddef>
+
+#include "detail/inplace_function_impl.hpp"
+
+namespace sig {
+
+/// Default number of bytes an Inplace_function stores without allocating.
+inline constexpr std::size_t default_inplace_capacity = 4 * sizeof(void*);
+
+/// Move-only function wrapper with small buffer storage.
+/** Callables up to \p Capacity bytes with a nothrow move constructor are stored
+ *  inside the Inplace_function itself, larger callables fall back to the heap.
+ *  Unlike std::function, move-only callables can be stored. Can be used as the
+ *  Slot_function of a Signal or the FunctionType of a Slot, in which case
+ *  typical capturing lambdas are stored inline in the connection. Signature
+ *  may be qualified with noexcept to get a noexcept call operator.
+ *  \param Signature Function type, R(Args...) or R(Args...) noexcept.
+ *  \param Capacity Size of the inline buffer in bytes. */
+template <typename Signature, std::size_t Capacity = default_inplace_capacity>
+class Inplace_function;
+
+template <typename R, typename... Args, std::size_t Capacity>
+class Inplace_function<R(Args...), Capacity>
+    : public Inplace_function_impl<false, Capacity, R, Args...> {
+   public:
+    using Inplace_function_impl<false, Capacity, R, Args...>::
+        Inplace_function_impl;
+    using Inplace_function_impl<false, Capacity, R, Args...>::operator=;
+};
+
+template <typename R, typename... Args, std::size_t Capacity>
+class Inplace_function<R(Args...) noexcept, Capacity>
+    : public Inplace_function_impl<true, Capacity, R, Args...> {
+   public:
+    using Inplace_function_impl<true, Capacity, R, Args...>::
+        Inplace_function_impl;
+    using Inplace_function_impl<true, Capacity, R, Args...>::operator=;
+};
+
+}  // namespace sig
+#endif  // SIGNALS_INPLACE_FUNCTION_HPP
@@ -0,0 +1,16 @@
+#ifndef SIGNALS_MOVE_ONLY_ARGUMENTS_HPP
+#define SIGNALS_MOVE_ONLY_ARGUMENTS_HPP
+#include <stdexcept>
+
+namespace sig {
+
+/// Thrown when an emission would pass move only arguments to more than one
+/// Slot.
+struct Move_only_arguments : std::logic_error {
+    explicit Move_only_arguments()
+        : logic_error{"Move only arguments can only be passed to one Slot."}
+    {}
+};
+
+}  // namespace sig
+#endif  // SIGNALS_MOVE_ONLY_ARGUMENTS_HPP
@@ -1,6 +1,8 @@
 #ifndef SIGNALS_OPTIONAL_LAST_VALUE_HPP
 #define SIGNALS_OPTIONAL_LAST_VALUE_HPP
+#include <functional>
 #include <optional>
+#include <type_traits>
 #include <utility>
 
 namespace sig {
@@ -8,7 +10,12 @@ namespace sig {
 /// A functor class that returns the last value in an iterator range.
 /** Attempts to dereference every iterator in the range [first, last).
  *  If the iterator range is empty, an empty opt::Optional object is returned,
- *  otherwise an opt::Optional wrapping the last value is returned. */
+ *  otherwise an opt::Optional wrapping the last value is returned. The value
+ *  is constructed inside the opt::Optional, so T needs neither a default
+ *  constructor nor assignment. When dereferencing returns a T by value, as
+ *  the Slot iterators of a Signal do, the iterator is advanced before the
+ *  value is stored: every value but the last is destroyed without being
+ *  copied or moved, and the last one is moved into the opt::Optional. */
 template <typename T>
 class Optional_last_value {
    public:
@@ -24,14 +31,46 @@ class Optional_last_value {
     auto operator()(InputIterator first, InputIterator last) const
         -> Result_type
     {
-        if (first == last)
-            return {std::nullopt};
-        auto temp = T();
+        auto result = Result_type{};
         while (first != last) {
-            temp = *first;
+            if constexpr (std::is_reference_v<decltype(*first)>) {
+                result.emplace(*first);
+                ++first;
+            }
+            else {
+                auto&& value = *first;
+                if (++first == last)
+                    result.emplace(std::move(value));
+            }
+        }
+        return result;
+    }
+};
+
+/// Specialization for reference return types.
+/** Refers to the object returned by the last Slot. */
+template <typename T>
+class Optional_last_value<T&> {
+   public:
+    /// Type of object the iterator range points to.
+    using Result_type = std::optional<std::reference_wrapper<T>>;
+
+   public:
+    /// \param  first  Input iterator to the first element in the range.
+    /// \param  last   Input iterator to one past the last element in the range.
+    /// \returns       A reference to the object returned by the last iterator
+    ///                of the range, wrapped in an opt::Optional.
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        auto result = Result_type{};
+        while (first != last) {
+            T& value = *first;
+            result.emplace(value);
             ++first;
         }
-        return {std::move(temp)};
+        return result;
     }
 };
 
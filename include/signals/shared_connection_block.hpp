@@ -1,15 +1,14 @@
 #ifndef SIGNALS_SHARED_CONNECTION_BLOCK_HPP
 #define SIGNALS_SHARED_CONNECTION_BLOCK_HPP
-#include <memory>
-
 #include "connection.hpp"
 
 namespace sig {
-class Connection_impl_base;
 
 /// Blocks a Signal/Slot Connection.
 /** Any number of Shared_connection_blocks can be built on a single connection,
- *  when the last block goes out of scope, the connection is unblocked. */
+ *  when the last block goes out of scope, the connection is unblocked. Blocks
+ *  are counted through the connection's Connection_handle, so they follow the
+ *  threading policy of the Signal. */
 class Shared_connection_block {
    public:
     /// Create a Shared_connection_block from a Connection and a boolean.
@@ -20,10 +19,10 @@ class Shared_connection_block {
      *  Connection at some other time by calling block(). */
     explicit Shared_connection_block(Connection const& conn = Connection{},
                                      bool initially_block   = true)
-        : connection_{conn.pimpl_}, blocking_{initially_block}
+        : connection_{conn}, blocking_{initially_block}
     {
         if (this->active())
-            connection_.lock()->add_block();
+            this->handle().add_block();
     }
 
     /// Creates a copy of \p x, increasing the block count on the
@@ -32,7 +31,7 @@ class Shared_connection_block {
         : connection_{x.connection_}, blocking_{x.blocking_}
     {
         if (this->active())
-            connection_.lock()->add_block();
+            this->handle().add_block();
     }
 
     /// Reset *this' Connection to point to \p x's Connection.
@@ -55,7 +54,7 @@ class Shared_connection_block {
     void unblock()
     {
         if (this->active()) {
-            connection_.lock()->remove_block();
+            this->handle().remove_block();
             blocking_ = false;
         }
     }
@@ -63,8 +62,8 @@ class Shared_connection_block {
     /// Reasserts a block on a Connection. No-op if currently blocking.
     void block()
     {
-        if (!connection_.expired() && !blocking_) {
-            connection_.lock()->add_block();
+        if (this->handle().alive() && !blocking_) {
+            this->handle().add_block();
             blocking_ = true;
         }
     }
@@ -72,14 +71,14 @@ class Shared_connection_block {
     /// \returns True if *this is currently blocking a Connection, else false.
     auto blocking() const -> bool
     {
-        return !connection_.expired() && blocking_;
+        return this->handle().alive() && blocking_;
     }
 
     /// \returns The Connection object associated with *this.
-    auto connection() const -> Connection { return Connection(connection_); }
+    auto connection() const -> Connection { return connection_; }
 
    private:
-    std::weak_ptr<Connection_impl_base> connection_;
+    Connection connection_;
     bool blocking_;
 
    private:
@@ -91,12 +90,17 @@ class Shared_connection_block {
         connection_ = x.connection_;
         blocking_   = x.blocking_;
         if (this->active())
-            connection_.lock()->add_block();
+            this->handle().add_block();
+    }
+
+    auto handle() const -> Connection_handle const&
+    {
+        return connection_.handle_;
     }
 
     // Return true if the connection pointed to is still alive and *this is
     // currently blocking.
-    auto active() -> bool { return !connection_.expired() && blocking_; }
+    auto active() const -> bool { return this->blocking(); }
 };
 
 }  // namespace sig
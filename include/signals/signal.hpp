@@ -1,23 +1,44 @@
 #ifndef SIGNALS_SIGNAL_HPP
 #define SIGNALS_SIGNAL_HPP
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <map>
+#include <iterator>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <iostream>  //temp
 
+#include "batch_order.hpp"
 #include "connection.hpp"
+#include "connection_pool.hpp"
+#include "detail/connection_container.hpp"
 #include "detail/connection_impl.hpp"
+#include "detail/connection_table.hpp"
+#include "detail/emission_waiters.hpp"
+#include "detail/epoch_snapshot.hpp"
+#include "detail/parallel_emission.hpp"
 #include "detail/slot_iterator.hpp"
+#include "dispatcher.hpp"
 #include "position.hpp"
 #include "signal_fwd.hpp"
 #include "slot_fwd.hpp"
+#include "stats.hpp"
+#include "threading.hpp"
+
+#ifdef SIGNALS_ENABLE_TRACING
+#include <string_view>
+
+#include "tracer.hpp"
+#endif
 
 namespace sig {
 
@@ -32,7 +53,8 @@ namespace sig {
  *  \param Group Type used to group Slots together to determine call order.
  *  \param Group_compare Comparison functor to determine order to call Slots.
  *  \param Slot_function Function wrapper type for Slots
- *  \param Mutex Mutex type for multithreaded use of Signals
+ *  \param Mutex Mutex type for multithreaded use of Signals, Null_mutex
+ *  selects the Single_threaded policy for the Signal and its connections.
  *  \sa Slot signal_fwd.hpp */
 template <typename Ret,
           typename... Args,
@@ -48,7 +70,8 @@ class Signal<Ret(Args...),
              Slot_function,
              Mutex> {
    private:
-    using Lock_t = std::scoped_lock<Mutex>;
+    using Lock_t    = std::scoped_lock<Mutex>;
+    using Threading = typename Threading_policy<Mutex>::type;
 
    public:
     using Result_type = typename Combiner::Result_type;
@@ -60,6 +83,21 @@ class Signal<Ret(Args...),
         Slot<Ret(Connection const&, Args...), Extended_slot_function>;
     using Arguments = std::tuple<Args...>;
 
+    /// Copy of the arguments of an emission, as received by awaiters.
+    using Emission_arguments = std::tuple<std::decay_t<Args>...>;
+
+#ifdef SIGNALS_ENABLE_COROUTINES
+   private:
+    using Waiters = Emission_waiters<Emission_arguments, Mutex, Threading>;
+
+   public:
+    /// Awaitable returned by next().
+    using Next_emission = typename Waiters::Next;
+
+    /// Stream of emissions returned by emissions().
+    using Emission_stream = typename Waiters::Stream;
+#endif
+
     /// Number of arguments the Signal takes.
     static constexpr int arity = std::tuple_size_v<Arguments>;
 
@@ -81,24 +119,41 @@ class Signal<Ret(Args...),
         auto const lock = Lock_t{other.mtx_};
         connections_    = other.connections_;
         combiner_       = other.combiner_;
+        pool_           = other.pool_;
+        table_          = other.table_;
+        this->copy_name(other);
+        this->publish();
     }
 
+    // Nothing here allocates: *this has never published, so taking the
+    // snapshot of \p other retires nothing.
     Signal(Signal&& other) noexcept
     {
         auto const lock = Lock_t{other.mtx_};
         connections_    = std::move(other.connections_);
         combiner_       = std::move(other.combiner_);
         tracker_        = std::move(other.tracker_);
+        pool_           = other.pool_;
+        table_          = other.table_;
+        this->copy_name(other);
+        this->take_totals(other);
+        snapshot_.take(other.snapshot_);
+#ifdef SIGNALS_ENABLE_COROUTINES
+        waiters_.take_new(other.waiters_);
+#endif
     }
 
     auto operator=(Signal const& other) -> Signal&
     {
         if (this != &other) {
-            auto lhs_lock = std::unique_lock{this->mtx_, std::defer_lock};
-            auto rhs_lock = std::unique_lock{other.mtx_, std::defer_lock};
-            std::lock(lhs_lock, rhs_lock);
-            connections_ = other.connections_;
-            combiner_    = other.combiner_;
+            auto const lock = std::scoped_lock{this->mtx_, other.mtx_};
+            connections_    = other.connections_;
+            combiner_       = other.combiner_;
+            pool_           = other.pool_;
+            table_          = other.table_;
+            this->copy_name(other);
+            this->clear_totals();
+            this->publish();
         }
         return *this;
     }
@@ -106,12 +161,18 @@ class Signal<Ret(Args...),
     auto operator=(Signal&& other) -> Signal&
     {
         if (this != &other) {
-            auto lhs_lock = std::unique_lock{this->mtx_, std::defer_lock};
-            auto rhs_lock = std::unique_lock{other.mtx_, std::defer_lock};
-            std::lock(lhs_lock, rhs_lock);
-            connections_ = std::move(other.connections_);
-            combiner_    = std::move(other.combiner_);
-            tracker_     = std::move(other.tracker_);
+            auto const lock = std::scoped_lock{this->mtx_, other.mtx_};
+            connections_    = std::move(other.connections_);
+            combiner_       = std::move(other.combiner_);
+            tracker_        = std::move(other.tracker_);
+            pool_           = other.pool_;
+            table_          = other.table_;
+            this->copy_name(other);
+            this->take_totals(other);
+            snapshot_.publish(other.snapshot_.release());
+#ifdef SIGNALS_ENABLE_COROUTINES
+            waiters_.take(other.waiters_);
+#endif
         }
         return *this;
     }
@@ -121,20 +182,23 @@ class Signal<Ret(Args...),
    public:
     /// Connect a Slot to *this either at the front or back of call queue.
     /** The Slot is inserted into a queue either at the front or the back
-     *  depending on \p position.
+     *  depending on \p position. Every connect rebuilds the snapshot read by
+     *  emissions, which copies the Signal's n connections into one new
+     *  allocation, so each connect is O(n) whatever the position. Use
+     *  connect_range() to connect many Slots at once.
      *  \param slot The Slot to connection to *this
      *  \param position The call position of \p slot
      *  \returns A Connection object referring to the Signal/Slot Connection.
+     *  \throws std::length_error If 2^31 connections of *this and its copies
+     *  are alive at once, this applies to every overload.
      *  \sa Position Slot */
-    auto connect(Slot_type const& slot, Position position = Position::at_back)
+    auto connect(Slot_type slot, Position position = Position::at_back)
         -> Connection
     {
-        auto c_impl     = std::make_shared<Connection_impl<Signature>>(slot);
         auto const lock = Lock_t{mtx_};
-        if (position == Position::at_front)
-            connections_.front.emplace(std::begin(connections_.front), c_impl);
-        else
-            connections_.back.push_back(c_impl);
+        auto c_impl     = this->make_connection(std::move(slot));
+        connections_.insert(c_impl, position);
+        this->publish();
         return Connection(c_impl);
     }
 
@@ -148,17 +212,59 @@ class Signal<Ret(Args...),
      *  \param position The position in the group that the Slot is added to.
      *  \returns A Connection object referring to the Signal/Slot Connection. */
     auto connect(Group const& group,
-                 Slot_type const& slot,
+                 Slot_type slot,
                  Position position = Position::at_back) -> Connection
     {
-        auto c_impl     = std::make_shared<Connection_impl<Signature>>(slot);
         auto const lock = Lock_t{mtx_};
-        if (position == Position::at_front) {
-            auto& group_container = connections_.grouped[group];
-            group_container.emplace(std::begin(group_container), c_impl);
-        }
-        else
-            connections_.grouped[group].push_back(c_impl);
+        auto c_impl     = this->make_connection(std::move(slot));
+        connections_.insert(group, c_impl, position);
+        this->publish();
+        return Connection(c_impl);
+    }
+
+    /// Connect a Slot to *this that is called on the thread draining \p
+    /// dispatcher.
+    /** An emission copies its arguments into a task posted to \p dispatcher
+     *  and returns without calling \p slot, the Slot is called later by
+     *  Dispatcher::run_pending(), unless the Connection was disconnected in the
+     *  meantime. Posting does not allocate while the copied arguments fit in
+     *  Dispatcher::argument_capacity bytes. Queued Slots return nothing to the
+     *  Combiner, so only Signals with a void return type accept them.
+     *  \param slot The Slot to connect to *this.
+     *  \param dispatcher Inbox of the thread \p slot is called on, it must
+     *  outlive the Connection.
+     *  \param position The call position of \p slot.
+     *  \returns A Connection object referring to the Signal/Slot Connection.
+     *  \sa Dispatcher */
+    auto connect(Slot_type slot,
+                 Dispatcher& dispatcher,
+                 Position position = Position::at_back) -> Connection
+    {
+        auto const lock = Lock_t{mtx_};
+        auto c_impl     = this->make_queued(std::move(slot), dispatcher);
+        connections_.insert(c_impl, position);
+        this->publish();
+        return Connection(c_impl);
+    }
+
+    /// Connect a Slot, called on the thread draining \p dispatcher, to *this
+    /// in a particular call group.
+    /** \param group The group the Slot will be a member of.
+     *  \param slot The Slot to be connected.
+     *  \param dispatcher Inbox of the thread \p slot is called on, it must
+     *  outlive the Connection.
+     *  \param position The position in the group that the Slot is added to.
+     *  \returns A Connection object referring to the Signal/Slot Connection.
+     *  \sa Dispatcher */
+    auto connect(Group const& group,
+                 Slot_type slot,
+                 Dispatcher& dispatcher,
+                 Position position = Position::at_back) -> Connection
+    {
+        auto const lock = Lock_t{mtx_};
+        auto c_impl     = this->make_queued(std::move(slot), dispatcher);
+        connections_.insert(group, c_impl, position);
+        this->publish();
         return Connection(c_impl);
     }
 
@@ -175,14 +281,12 @@ class Signal<Ret(Args...),
     auto connect_extended(Extended_slot const& ext_slot,
                           Position position = Position::at_back) -> Connection
     {
-        auto c_impl = std::make_shared<Connection_impl<Signature>>();
-        auto c      = Connection(c_impl);
-        c_impl->emplace_extended(ext_slot, c);
         auto const lock = Lock_t{mtx_};
-        if (position == Position::at_front)
-            connections_.front.emplace(std::begin(connections_.front), c_impl);
-        else
-            connections_.back.push_back(c_impl);
+        auto c_impl     = this->make_connection();
+        auto c          = Connection(c_impl);
+        c_impl->emplace_extended(ext_slot, c);
+        connections_.insert(c_impl, position);
+        this->publish();
         return c;
     }
 
@@ -205,133 +309,448 @@ class Signal<Ret(Args...),
                           Extended_slot const& ext_slot,
                           Position position = Position::at_back) -> Connection
     {
-        auto c_impl = std::make_shared<Connection_impl<Signature>>();
-        auto c      = Connection(c_impl);
-        c_impl->emplace_extended(ext_slot, c);
         auto const lock = Lock_t{mtx_};
-        if (position == Position::at_front) {
-            auto& group_container = connections_.grouped[group];
-            group_container.emplace(std::begin(group_container), c_impl);
-        }
-        else
-            connections_.grouped[group].push_back(c_impl);
+        auto c_impl     = this->make_connection();
+        auto c          = Connection(c_impl);
+        c_impl->emplace_extended(ext_slot, c);
+        connections_.insert(group, c_impl, position);
+        this->publish();
         return c;
     }
 
+    /// Connect every Slot in \p slots to *this, as one block at the front or
+    /// back of the call queue.
+    /** Equivalent to connecting each Slot in turn, except that the lock is
+     *  taken, the call queue grown and the connection snapshot rebuilt once
+     *  for the whole range, so connecting n Slots is O(n) rather than O(n^2).
+     *  The block keeps the order of \p slots, also when it goes at_front.
+     *  \param slots Forward range of objects convertible to Slot_type, moved
+     *  from if \p slots is an rvalue.
+     *  \param position The call position of the block.
+     *  \returns A Connection for each Slot, in the order of \p slots. */
+    template <typename Range>
+    auto connect_range(Range&& slots, Position position = Position::at_back)
+        -> std::vector<Connection>
+    {
+        auto const lock    = Lock_t{mtx_};
+        auto const c_impls = this->make_connections(std::forward<Range>(slots));
+        connections_.insert_range(std::cbegin(c_impls), std::cend(c_impls),
+                                  position);
+        this->publish();
+        return {std::cbegin(c_impls), std::cend(c_impls)};
+    }
+
+    /// Connect every Slot in \p slots to *this in a particular call group.
+    /** As connect_range above, with the block inserted at the front or back of
+     *  \p group.
+     *  \param group The group the Slots will be members of.
+     *  \param slots Forward range of objects convertible to Slot_type, moved
+     *  from if \p slots is an rvalue.
+     *  \param position The position in the group that the block is added to.
+     *  \returns A Connection for each Slot, in the order of \p slots. */
+    template <typename Range>
+    auto connect_range(Group const& group,
+                       Range&& slots,
+                       Position position = Position::at_back)
+        -> std::vector<Connection>
+    {
+        auto const lock    = Lock_t{mtx_};
+        auto const c_impls = this->make_connections(std::forward<Range>(slots));
+        connections_.insert_range(group, std::cbegin(c_impls),
+                                  std::cend(c_impls), position);
+        this->publish();
+        return {std::cbegin(c_impls), std::cend(c_impls)};
+    }
+
+    /// Disconnect every Connection in \p connections.
+    /** Equivalent to calling Connection::disconnect() on each, except that the
+     *  disconnected Slots are also erased from *this in a single pass under
+     *  one lock, rather than left for a later emission to reclaim. Connections
+     *  to other Signals are disconnected as well, and reclaimed by their own
+     *  Signal.
+     *  \param connections Range of Connection objects. */
+    template <typename Range,
+              typename = std::enable_if_t<std::is_convertible_v<
+                  decltype(*std::cbegin(std::declval<Range const&>())),
+                  Connection const&>>>
+    void disconnect(Range const& connections)
+    {
+        auto const lock = Lock_t{mtx_};
+        for (auto const& connection : connections)
+            connection.disconnect();
+        this->publish();
+    }
+
     /// Disconnect all Slots in a given group.
     /** \param group The group to disconnect. */
     void disconnect(Group const& group)
     {
-        auto const lock = Lock_t{mtx_};
-        for (auto& connection : connections_.grouped[group]) {
-            connection->disconnect();
-        }
-        connections_.grouped.erase(group);
+        auto const lock          = Lock_t{mtx_};
+        auto const [first, last] = connections_.group_range(group);
+        std::for_each(first, last, [this](auto const& c) {
+            c->disconnect();
+            this->retire(*c);
+        });
+        connections_.erase_group(group);
+        this->publish();
     }
 
     /// Disconnect all Slots attached to *this.
     void disconnect_all_slots()
     {
         auto const lock = Lock_t{mtx_};
-        for (auto& connection : connections_.front) {
-            connection->disconnect();
-        }
-        for (auto& group : connections_.grouped) {
-            for (auto& connection : group.second) {
-                connection->disconnect();
-            }
-        }
-        for (auto& connection : connections_.back) {
+        for (auto const& connection : connections_) {
             connection->disconnect();
+            this->retire(*connection);
         }
-        connections_.front.clear();
-        connections_.grouped.clear();
-        connections_.back.clear();
+        connections_.clear();
+        this->publish();
     }
 
     /// Query whether or not *this has any Slots connected to it.
     /** \returns True if *this has no Slots attached, false otherwise. */
     auto empty() const -> bool
     {
-        auto const lock = Lock_t{mtx_};
-        for (auto& connection : connections_.front) {
-            if (connection->connected())
-                return false;
-        }
-        for (auto& group : connections_.grouped) {
-            for (auto& connection : group.second) {
-                if (connection->connected())
-                    return false;
-            }
-        }
-        for (auto& connection : connections_.back) {
-            if (connection->connected())
-                return false;
-        }
-        return true;
+        auto const reader = State_reader{snapshot_};
+        auto const state  = reader.get();
+        if (state == nullptr)
+            return true;
+        return std::none_of(std::cbegin(state->slots), std::cend(state->slots),
+                            [](auto const& c) { return c->connected(); });
     }
 
     /// Access the number of Slots connected to *this.
     /** \returns The number of Slots currently connected to *this. */
     auto num_slots() const -> std::size_t
     {
-        auto const lock = Lock_t{mtx_};
-        auto size       = 0uL;
-        for (auto& connection : connections_.front) {
-            if (connection->connected())
-                ++size;
-        }
-        for (auto& group : connections_.grouped) {
-            for (auto& connection : group.second) {
-                if (connection->connected())
-                    ++size;
-            }
-        }
-        for (auto& connection : connections_.back) {
-            if (connection->connected())
-                ++size;
-        }
-        return size;
+        auto const reader = State_reader{snapshot_};
+        auto const state  = reader.get();
+        if (state == nullptr)
+            return 0;
+        return std::count_if(std::cbegin(state->slots), std::cend(state->slots),
+                             [](auto const& c) { return c->connected(); });
     }
 
     /// Call operator to call all connected Slots.
     /** All arguments to this call operator are passed onto the Slots. The Slots
      *  are called by how they were attached to *this. By default this returns
-     *  the return value of the last Slot that was called.
+     *  the return value of the last Slot that was called. Slots are called
+     *  directly from the current connection snapshot with \p args held by
+     *  reference, no heap allocation is made per emission. The Combiner is
+     *  published along with the Slots, so the emission reads both with a
+     *  single atomic load and takes no lock. An empty Combiner callable as
+     *  const, such as Optional_last_value, is called in place. Any other
+     *  Combiner is copied by each emission, so that concurrent emissions never
+     *  share its state, and the copy's non-const call operator is used if it
+     *  has one, as for a non-const Signal before. If a
+     *  parameter taken by value cannot be copied, this emits as
+     *  emit_forward() does.
      *  \param args The arguments you are passing onto the Slots.
      *  \returns An Optional containing a value determined by the Combiner. */
     template <typename... Params>
-    auto operator()(Params&&... args) -> Result_type
+    auto operator()(Params&&... args) const -> Result_type
     {
         if (!this->enabled())
             return Result_type();
-        auto slots = bind_args(std::forward<Params>(args)...);
-        auto lock  = std::unique_lock{mtx_};
-        auto comb  = combiner_;
-        lock.unlock();
-        return comb(Bound_slot_iterator{std::begin(slots)},
-                    Bound_slot_iterator{std::end(slots)});
+        this->record_emissions(1);
+#ifdef SIGNALS_ENABLE_TRACING
+        auto const trace = Trace_scope{name_.load(std::memory_order_relaxed),
+                                       "emission"};
+#endif
+        auto const collect = Collect_retired{*this};
+        auto const reader  = this->read_state();
+        if constexpr (copyable_arguments)
+            return this->emit(*reader.get(), args...);
+        else {
+            return this->template emit<true>(*reader.get(),
+                                             std::forward<Params>(args)...);
+        }
     }
 
-    /// Call operator to call all connected Slots.
-    /** All arguments to this call operator are passed onto the Slots. The Slots
-     *  are called by how they were attached to *this. By default this returns
-     *  the return value of the last Slot that was called. const overload is
-     *  called with a const Combiner.
+    /// Call all connected Slots, moving rvalue arguments into the last one.
+    /** Like operator(), except that arguments passed as rvalues are passed on
+     *  as rvalues to the last Slot called, which can take them over without a
+     *  copy. Every other Slot receives them as lvalues, as with operator().
+     *  The last Slot is the last one that can be called when the emission
+     *  starts, once it returns this emission calls no further Slot, even one
+     *  unblocked by an earlier Slot. Slot parameters that are lvalue
+     *  references always receive lvalues. Coroutines awaiting next() or
+     *  emissions() are not resumed, the arguments are gone by the time the
+     *  Slots return.
      *  \param args The arguments you are passing onto the Slots.
-     *  \returns An Optional containing a value determined by the Combiner. */
+     *  \returns An Optional containing a value determined by the Combiner.
+     *  \throws Move_only_arguments If a parameter taken by value cannot be
+     *  copied and more than one Slot can be called when the emission starts,
+     *  before any is called. The Combiner is not consulted, so this also holds
+     *  for one that stops after the first Slot, such as Optional_first_value.
+     */
     template <typename... Params>
-    auto operator()(Params&&... args) const -> Result_type
+    auto emit_forward(Params&&... args) const -> Result_type
+    {
+        if (!this->enabled())
+            return Result_type();
+        this->record_emissions(1);
+        auto const collect = Collect_retired{*this};
+        auto const reader  = this->read_state();
+        return this->template emit<true>(*reader.get(),
+                                         std::forward<Params>(args)...);
+    }
+
+    /// Emit once for each element of \p batch, writing the results to \p out.
+    /** Equivalent to calling operator() with each element of \p batch in turn,
+     *  except that the connection snapshot and the enabled state are read once
+     *  for the whole batch, so Slots connected by a Slot during the batch are
+     *  not called until the next emission. Coroutines awaiting next() or
+     *  emissions() are resumed with each element once its Combiner has
+     *  returned. Each element is traced as an emission, except with
+     *  Batch_order::slot_major, where the whole batch is traced as a single
+     *  event of category "batch" holding the Slot calls.
+     *  \param batch Range of tuple-like elements, each holding the arguments
+     *  of one emission as accepted by std::apply.
+     *  \param out Output iterator receiving one Result_type per element, in
+     *  order, typically into storage allocated ahead of time.
+     *  \param order With Batch_order::slot_major each Slot is called for every
+     *  element before the next Slot is called, which keeps one Slot's code and
+     *  data hot at a time. The Slot results are then buffered and the
+     *  Combiner runs once per element afterwards.
+     *  \returns \p out, one past the last result written. */
+    template <typename Range,
+              typename OutputIterator,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<OutputIterator>, Batch_order>>>
+    auto emit_batch(Range const& batch,
+                    OutputIterator out,
+                    Batch_order order = Batch_order::emission_major) const
+        -> OutputIterator
+    {
+        static_assert(!std::is_void_v<Result_type>,
+                      "emit_batch without an output iterator for void.");
+        this->emit_each(batch, order, [&out](auto&& result) {
+            *out = std::forward<decltype(result)>(result);
+            ++out;
+        });
+        return out;
+    }
+
+    /// Emit once for each element of \p batch.
+    /** \param batch Range of tuple-like elements, each holding the arguments
+     *  of one emission as accepted by std::apply.
+     *  \param order Order to call the Slots in, see the overload above.
+     *  \returns A vector with the Result_type of each emission in order,
+     *  allocated once for the whole batch, or nothing if Result_type is void.
+     *  \sa Batch_order */
+    template <typename Range>
+    auto emit_batch(Range const& batch,
+                    Batch_order order = Batch_order::emission_major) const
+    {
+        if constexpr (std::is_void_v<Result_type>)
+            this->emit_each(batch, order, [] {});
+        else {
+            auto results = std::vector<Result_type>{};
+            results.reserve(static_cast<std::size_t>(
+                std::distance(std::begin(batch), std::end(batch))));
+            this->emit_batch(batch, std::back_inserter(results), order);
+            return results;
+        }
+    }
+
+    /// Call all connected Slots on \p executor.
+    /** The connections and Combiner are taken from the current snapshot and
+     *  \p args are copied, as the Signal's decayed argument types, before
+     *  returning. The Slots and the Combiner then run on \p executor, which
+     *  must provide execute(task) for a move-only nullary callable task, such
+     *  as Thread_pool. The task does not refer to *this, so *this may be
+     *  destroyed before it runs. Only multi-threaded Signals can emit this
+     *  way, the task releases its share of the connections on the executor's
+     *  thread.
+     *  \param executor Runs the emission, kept by reference during this call.
+     *  \param args The arguments you are passing onto the Slots.
+     *  \returns A future holding the value determined by the Combiner, or the
+     *  exception thrown by a Slot or the Combiner. */
+    template <typename Executor, typename... Params>
+    auto emit_async(Executor& executor, Params&&... args) const
+        -> std::future<Result_type>
+    {
+        static_assert(std::is_same_v<Threading, Multi_threaded>,
+                      "emit_async requires a multi-threaded Signal.");
+        if (!this->enabled()) {
+            auto disabled = std::promise<Result_type>{};
+            if constexpr (std::is_void_v<Result_type>)
+                disabled.set_value();
+            else
+                disabled.set_value(Result_type());
+            return disabled.get_future();
+        }
+        this->record_emissions(1);
+        auto emission = std::packaged_task<Result_type()>{
+            [state = this->load_state(),
+             bound = std::tuple<std::decay_t<Args>...>{
+                 std::forward<Params>(args)...}]() mutable {
+                auto dead = std::size_t{0};
+                return std::apply(
+                    [&](auto&... copies) {
+                        return call_combiner(*state, dead, copies...);
+                    },
+                    bound);
+            }};
+        auto result = emission.get_future();
+        executor.execute(std::move(emission));
+        return result;
+    }
+
+    /// Call all connected Slots, running each group's Slots concurrently.
+    /** Ungrouped at_front Slots are called in order on the calling thread,
+     *  then each group in Group_compare order, then ungrouped at_back Slots in
+     *  order on the calling thread. The Slots of a group are spread over \p
+     *  executor and the calling thread, and every one of them returns before
+     *  the next group starts. The Slot results are kept in connection order
+     *  and passed to the Combiner once all Slots have returned, so the
+     *  Combiner reduces them deterministically, but cannot stop Slots from
+     *  being called. If Slots in a group throw, the first exception is
+     *  rethrown once the group has finished and later groups are not called.
+     *  \param executor Provides execute(task) for a move-only nullary task,
+     *  such as Thread_pool. Emitting from one of its threads is fine.
+     *  \param args The arguments you are passing onto the Slots, shared by
+     *  reference between the threads.
+     *  \returns An Optional containing a value determined by the Combiner. */
+    template <typename Executor, typename... Params>
+    auto emit_parallel(Executor& executor, Params&&... args) const
+        -> Result_type
     {
+        static_assert(std::is_same_v<Threading, Multi_threaded>,
+                      "emit_parallel requires a multi-threaded Signal.");
         if (!this->enabled())
             return Result_type();
-        auto slots            = bind_args(std::forward<Params>(args)...);
-        auto lock             = std::unique_lock{mtx_};
-        auto const const_comb = combiner_;
-        lock.unlock();
-        return const_comb(Bound_slot_iterator{std::begin(slots)},
-                          Bound_slot_iterator{std::end(slots)});
+        this->record_emissions(1);
+        auto const collect  = Collect_retired{*this};
+        auto const reader   = this->read_state();
+        auto const state    = reader.get();
+        auto const& slots   = state->slots;
+        auto const bound    = std::tuple<Params&...>{args...};
+        auto results        = Result_buffer<Ret>{slots.size()};
+        auto first_of_phase = std::size_t{0};
+        auto call           = [&](std::size_t i) {
+            auto const& connection = slots[first_of_phase + i];
+            if (callable(*connection)) {
+                results.emplace(first_of_phase + i, [&]() -> Ret {
+                    return connection->call(bound);
+                });
+            }
+        };
+        for (auto i = std::size_t{0}; i < state->front_size; ++i)
+            call(i);
+        first_of_phase = state->front_size;
+        for (auto const end : state->group_ends) {
+            run_parallel(executor, end - first_of_phase, call);
+            first_of_phase = end;
+        }
+        for (auto i = std::size_t{0}; first_of_phase + i < slots.size(); ++i)
+            call(i);
+        return invoke_combiner(*state, std::cbegin(results),
+                               std::cend(results));
+    }
+
+#ifdef SIGNALS_ENABLE_COROUTINES
+    /// Awaitable resuming with the arguments of the next call operator.
+    /** co_await signal.next() suspends the awaiting coroutine until the next
+     *  call of operator() on *this, then resumes it on the emitting thread,
+     *  after the Slots, with a copy of the arguments. The registration lives
+     *  in the awaiting coroutine's frame, so nothing is allocated. Moving
+     *  *this, by construction or assignment, hands its waiters to the Signal
+     *  moved to, copies start without any. Only available with
+     *  SIGNALS_ENABLE_COROUTINES defined for the whole program.
+     *  \returns An awaitable whose co_await yields an Emission_arguments. */
+    auto next() const -> Next_emission { return Next_emission{waiters_}; }
+
+    /// Asynchronous stream of every call operator from now on.
+    /** co_await stream.next() yields the arguments of each emission in turn,
+     *  suspending while none is buffered. Emissions are buffered from the
+     *  creation of the stream until it is destroyed, so none are missed
+     *  between two awaits. A stream follows *this when it is moved, as
+     *  next() does. Only available with SIGNALS_ENABLE_COROUTINES defined.
+     *  \returns An Emission_stream, which must not outlive the Signal it
+     *  follows. */
+    auto emissions() const -> Emission_stream
+    {
+        return Emission_stream{waiters_};
     }
+#endif
+
+#ifdef SIGNALS_ENABLE_STATS
+    /// Access the statistics recorded by *this and its connections.
+    /** Emissions, Slot calls and Slots passed over are counted as they
+     *  happen, and each Slot call is timed. Counters are read one at a time
+     *  while emissions may be running, so the totals are not an atomic
+     *  snapshot. A copy of a Signal shares its connections with the original,
+     *  so both report the same statistics for each Slot, and resetting them
+     *  through either resets them for both, while the copy's emission count
+     *  and the totals of its erased connections start from zero. A move
+     *  carries every counter over. Only available when SIGNALS_ENABLE_STATS
+     *  is defined, which must then be the case in every translation unit of
+     *  the program.
+     *  \returns Totals since construction or the last reset_stats(), and the
+     *  statistics of each connected Slot. */
+    auto stats() const -> Signal_stats
+    {
+        auto const lock = Lock_t{mtx_};
+        auto stats      = retired_;
+        stats.emissions = emissions_.load(std::memory_order_relaxed);
+        for (auto const& connection : connections_) {
+            auto slot = connection->recorder().snapshot();
+            stats += slot;
+            if (connection->connected()) {
+                slot.connection = connection->handle();
+                stats.slots.push_back(slot);
+            }
+        }
+        return stats;
+    }
+
+    /// Set every counter of *this and its connections back to zero.
+    /** Copies of *this sharing a connection see its counters reset too. */
+    void reset_stats()
+    {
+        auto const lock = Lock_t{mtx_};
+        this->clear_totals();
+        for (auto const& connection : connections_)
+            connection->recorder().reset();
+    }
+#endif
+
+#ifdef SIGNALS_ENABLE_TRACING
+    /// Set the name emissions of *this are traced under.
+    /** Each distinct name is copied once and kept for the lifetime of the
+     *  process, see Tracer::intern(). Copies of a Signal take its name. Only
+     *  available when SIGNALS_ENABLE_TRACING is defined.
+     *  \param name Shown on emission events, "Signal" by default. */
+    void set_name(std::string_view name)
+    {
+        name_.store(Tracer::instance().intern(name), std::memory_order_relaxed);
+    }
+
+    /// \returns The name emissions of *this are traced under.
+    auto name() const -> std::string_view
+    {
+        return name_.load(std::memory_order_relaxed);
+    }
+
+    /// Set the label calls to the Slot of \p connection are traced under.
+    /** No-op if \p connection is not connected to *this. The label belongs to
+     *  the connection, so Signals copied from *this share it. Only available
+     *  when SIGNALS_ENABLE_TRACING is defined.
+     *  \param label Shown on Slot events, "Slot" by default. */
+    void set_slot_label(Connection const& connection, std::string_view label)
+    {
+        auto const handle = connection.handle();
+        auto const lock   = Lock_t{mtx_};
+        for (auto const& c : connections_) {
+            if (c->handle() == handle) {
+                c->set_label(Tracer::instance().intern(label));
+                return;
+            }
+        }
+    }
+#endif
 
     /// Access to the Combiner object.
     /** \returns A copy of the Combiner object used by *this. */
@@ -344,12 +763,36 @@ class Signal<Ret(Args...),
     /// Set the Combiner object to a new value.
     /** A Combiner is a functor that takes a range of input iterators, it
      *  dereferences each iterator in the range and returns some value as a
-     *  Result_type.
+     *  Result_type. Emissions already running finish with the previous
+     *  Combiner.
      *  \params comb The Combiner object to set for *this. */
     void set_combiner(Combiner const& comb)
     {
         auto const lock = Lock_t{mtx_};
         combiner_       = comb;
+        this->publish();
+    }
+
+    /// Allocate connections made from now on from \p pool.
+    /** By default each Signal creates its own pool on the first connect. A
+     *  pool can be shared by Signals with the same Mutex type, so that their
+     *  connections are recycled together. Connections already made stay in
+     *  the pool they came from, which they keep alive.
+     *  \param pool The Connection_pool to allocate from. */
+    void set_connection_pool(std::shared_ptr<Connection_pool<Mutex>> pool)
+    {
+        auto const lock = Lock_t{mtx_};
+        pool_           = std::move(pool);
+    }
+
+    /// Access the pool new connections are allocated from.
+    /** \returns The Connection_pool of *this, created if there is none yet. */
+    auto connection_pool() const -> std::shared_ptr<Connection_pool<Mutex>>
+    {
+        auto const lock = Lock_t{mtx_};
+        if (pool_ == nullptr)
+            pool_ = std::make_shared<Pool>();
+        return pool_;
     }
 
     /// Shared pointer that can track the lifetime of this Signal.
@@ -366,80 +809,459 @@ class Signal<Ret(Args...),
      *  \returns True if *this is enabled, false otherwise. */
     auto enabled() const -> bool
     {
-        auto const lock = Lock_t{mtx_};
-        return enabled_;
+        return enabled_.load(std::memory_order_relaxed);
     }
 
     /// Enable the Signal.
     /** Connected Slots will be called when call operator is summoned. */
-    void enable()
-    {
-        auto const lock = Lock_t{mtx_};
-        enabled_        = true;
-    }
+    void enable() { enabled_.store(true, std::memory_order_relaxed); }
 
     /// Disable the Signal.
     /** Connected Slots will _not_ be called when call operator is summoned. */
-    void disable()
-    {
-        auto const lock = Lock_t{mtx_};
-        enabled_        = false;
-    }
+    void disable() { enabled_.store(false, std::memory_order_relaxed); }
 
    private:
-    using Bound_slot_container = std::vector<std::function<Ret()>>;
-    using Bound_slot_iterator =
-        Slot_iterator<typename Bound_slot_container::iterator>;
-
-    class Connection_container {
-       public:
-        using Position_container =
-            std::vector<std::shared_ptr<Connection_impl<Signature>>>;
-        using Group_container =
-            std::map<Group, Position_container, Group_compare>;
-
-       public:
-        Position_container front;
-        Group_container grouped;
-        Position_container back;
-
-       public:
-        Connection_container() = default;
-        Connection_container(Group_compare const& compare) : grouped{compare} {}
+    using Connection_impl_t =
+        Connection_impl<Signature, Slot_function, Threading>;
+
+    // Call ordered list of every connection, shared with in-flight emissions.
+    using Connection_list = std::vector<std::shared_ptr<Connection_impl_t>>;
+
+    using Connection_container =
+        sig::Connection_container<std::shared_ptr<Connection_impl_t>,
+                                  Group,
+                                  Group_compare>;
+
+    // Everything an emission reads, published to emitters as one immutable
+    // object so that a single atomic load gives a consistent view of both.
+    // front_size and group_ends mark the phases of a parallel emission.
+    // Shared ownership is taken only by emissions outliving their caller.
+    struct Emission_state : std::enable_shared_from_this<Emission_state> {
+        Emission_state(Connection_container const& connections,
+                       Combiner const& comb)
+            : slots(std::cbegin(connections), std::cend(connections)),
+              front_size{connections.front_size()},
+              group_ends{connections.group_ends()},
+              combiner{comb}
+        {}
+
+        Connection_list slots;
+        std::size_t front_size;
+        std::vector<std::size_t> group_ends;
+        Combiner combiner;
+    };
+
+    using Snapshot = std::shared_ptr<Emission_state const>;
+
+    using State_reader =
+        typename Epoch_snapshot<Emission_state, Threading>::Reader;
+
+    // Calls collect_retired() when destroyed. Declared ahead of an emission's
+    // State_reader, so that the snapshot a reclaim() or a Slot replaced during
+    // the emission is destroyed before the emission returns.
+    struct Collect_retired {
+        Signal const& signal;
+
+        ~Collect_retired() { signal.collect_retired(); }
     };
 
+    using Pool = Connection_pool<Mutex>;
+
+    using Table_ref = typename Connection_table<Threading>::Ref;
+
+    template <typename Bound_args, bool Forward = false>
+    using Bound_slot_iterator =
+        Slot_iterator<typename Connection_list::const_iterator,
+                      Bound_args,
+                      Forward>;
+
+    // False if the arguments of one emission cannot be passed to every Slot.
+    static constexpr bool copyable_arguments =
+        Connection_impl_t::copyable_arguments;
+
    private:
-    Connection_container connections_;
+    // Mutable so that const emissions can reclaim dead connections.
+    mutable Connection_container connections_;
+    mutable Epoch_snapshot<Emission_state, Threading> snapshot_;
     mutable std::optional<std::shared_ptr<int>> tracker_;
+    mutable std::shared_ptr<Pool> pool_;
+    mutable Table_ref table_;  // Shared with copies, like pool_.
     mutable Mutex mtx_;
-    bool enabled_ = true;
+#ifdef SIGNALS_ENABLE_COROUTINES
+    mutable Waiters waiters_;
+#endif
+#ifdef SIGNALS_ENABLE_STATS
+    mutable typename Threading::template Atomic<std::uint64_t> emissions_ = 0;
+    mutable Signal_stats retired_;  // Totals of erased connections.
+#endif
+#ifdef SIGNALS_ENABLE_TRACING
+    typename Threading::template Atomic<char const*> name_ = "Signal";
+#endif
+    typename Threading::template Atomic<bool> enabled_ = true;
     Combiner combiner_;
 
    private:
-    // Binds parameters to each Slot so Combiner does not need to know them.
+    // Rebuilds the snapshot read by emissions. Must be called with mtx_ held
+    // after every change to connections_ or combiner_. Disconnected and expired
+    // connections are dropped first, so each rebuild also compacts. O(n) with
+    // one allocation, the snapshot shares no storage with connections_. Emitters
+    // read the snapshot inside an epoch read section and never take mtx_ or a
+    // reference count. Emissions already running, including the one whose
+    // Slot caused this rebuild, keep walking the previous snapshot, which is
+    // destroyed by publish() or collect_retired() once they have all returned.
+    void publish() const
+    {
+        this->remove_dead();
+        snapshot_.publish(
+            std::make_shared<Emission_state>(connections_, combiner_));
+    }
+
+    // Read section of the current snapshot. A Signal that has not published
+    // yet, because nothing was ever connected or it was moved from, publishes
+    // once under mtx_.
+    auto read_state() const -> State_reader
+    {
+        if (!snapshot_.published()) {
+            auto const lock = Lock_t{mtx_};
+            if (!snapshot_.published())
+                this->publish();
+        }
+        return State_reader{snapshot_};
+    }
+
+    // Shared ownership of the current snapshot, for emissions that outlive
+    // the call that started them.
+    auto load_state() const -> Snapshot
+    {
+        auto const reader = this->read_state();
+        return reader.get()->shared_from_this();
+    }
+
+    // Erases disconnected and expired connections from connections_, along
+    // with any group left empty. Must be called with mtx_ held.
+    void remove_dead() const
+    {
+        connections_.remove_if([this](auto const& connection) {
+            auto const dead = !connection->connected() ||
+                              connection->get_slot().expired();
+            if (dead)
+                this->retire(*connection);
+            return dead;
+        });
+    }
+
+    // Calls call_combiner(), then reclaims dead connections if the emission
+    // came across enough of them, then resumes coroutines awaiting it. With
+    // Forward set, \p args are forwarded to the last Slot called and awaiting
+    // coroutines are not resumed.
+    template <bool Forward = false, typename... Params>
+    auto emit(Emission_state const& state, Params&&... args) const
+        -> Result_type
+    {
+        if constexpr (std::is_void_v<Result_type>) {
+            auto dead = std::size_t{0};
+            call_combiner<Forward>(state, dead, std::forward<Params>(args)...);
+            this->reclaim(state, dead);
+            if constexpr (!Forward)
+                this->notify_waiters(args...);
+        }
+        else {
+            return this->template emit_value<Forward>(
+                state, std::forward<Params>(args)...);
+        }
+    }
+
+    // emit() for a non void Result_type. A function of its own so the result
+    // is returned without a move, GCC does not elide a named return value
+    // declared inside an if constexpr branch.
+    template <bool Forward, typename... Params>
+    auto emit_value(Emission_state const& state, Params&&... args) const
+        -> Result_type
+    {
+        auto dead   = std::size_t{0};
+        auto result =
+            call_combiner<Forward>(state, dead, std::forward<Params>(args)...);
+        this->reclaim(state, dead);
+        if constexpr (!Forward)
+            this->notify_waiters(args...);
+        return result;
+    }
+
+    // Calls the Combiner of \p state with \p args bound by reference, adding
+    // the number of dead connections come across to \p dead. Lvalues are
+    // bound as lvalue references, with Forward set rvalues are bound as rvalue
+    // references, for the last Slot called.
+    template <bool Forward = false, typename... Params>
+    static auto call_combiner(Emission_state const& state,
+                              std::size_t& dead,
+                              Params&&... args) -> Result_type
+    {
+        using Bound = std::tuple<Params&&...>;
+        using Iter  = Bound_slot_iterator<Bound, Forward>;
+        auto const bound = Bound{std::forward<Params>(args)...};
+        auto const first = std::cbegin(state.slots);
+        auto const last  = std::cend(state.slots);
+        return invoke_combiner(state, Iter{first, last, bound, dead},
+                               Iter{last, last, bound, dead});
+    }
+
+    // Calls the Combiner of \p state over [first, last). The snapshot is
+    // shared by concurrent emissions, so only a Combiner without state is
+    // called in place, any other is copied first. Decided at compile time.
+    template <typename Iter>
+    static auto invoke_combiner(Emission_state const& state,
+                                Iter first,
+                                Iter last) -> Result_type
+    {
+        if constexpr (std::is_empty_v<Combiner> &&
+                      std::is_invocable_v<Combiner const&, Iter, Iter>) {
+            return state.combiner(first, last);
+        }
+        else
+            return Combiner{state.combiner}(first, last);
+    }
+
+    // Allocates a Connection_impl from pool_ and registers it in table_,
+    // creating both on first use. Must be called with mtx_ held.
     template <typename... Params>
-    auto bind_args(Params&&... args) const -> Bound_slot_container
-    {
-        auto bound_slots = Bound_slot_container{};
-        // Helper Function
-        auto bind_slots = [&bound_slots, &args...](auto& conn_container) {
-            for (auto& connection : conn_container) {
-                if (connection->connected() && !connection->blocked() &&
-                    !connection->get_slot().expired()) {
-                    auto& slot = connection->get_slot();
-                    // you get lucky the args... are still in scope while needed
-                    bound_slots.push_back(
-                        [&slot, &args...] { return slot(args...); });
+    auto make_connection(Params&&... args) const
+        -> std::shared_ptr<Connection_impl_t>
+    {
+        if (pool_ == nullptr)
+            pool_ = std::make_shared<Pool>();
+        return std::allocate_shared<Connection_impl_t>(
+            Connection_pool_allocator<Connection_impl_t, Mutex>{pool_},
+            table_.get(), std::forward<Params>(args)...);
+    }
+
+    // One Connection_impl per element of \p slots, in order. Must be called
+    // with mtx_ held.
+    template <typename Range>
+    auto make_connections(Range&& slots) const -> Connection_list
+    {
+        auto c_impls = Connection_list{};
+        c_impls.reserve(static_cast<std::size_t>(
+            std::distance(std::begin(slots), std::end(slots))));
+        for (auto& slot : slots) {
+            if constexpr (std::is_lvalue_reference_v<Range>)
+                c_impls.push_back(this->make_connection(Slot_type(slot)));
+            else {
+                c_impls.push_back(
+                    this->make_connection(Slot_type(std::move(slot))));
+            }
+        }
+        return c_impls;
+    }
+
+    // Connection_impl posting calls of \p slot to \p dispatcher. Must be
+    // called with mtx_ held.
+    auto make_queued(Slot_type slot, Dispatcher& dispatcher) const
+        -> std::shared_ptr<Connection_impl_t>
+    {
+        static_assert(std::is_void_v<Ret>,
+                      "Queued connections need a void Signal return type.");
+        auto c_impl = this->make_connection();
+        c_impl->emplace_queued(std::move(slot), dispatcher, Connection(c_impl));
+        return c_impl;
+    }
+
+    // Emits once per element of \p batch, passing each Result_type to \p
+    // sink in order, or calling \p sink with no arguments if it is void.
+    template <typename Range, typename Sink>
+    void emit_each(Range const& batch, Batch_order order, Sink&& sink) const
+    {
+        auto const emissions = static_cast<std::size_t>(
+            std::distance(std::begin(batch), std::end(batch)));
+        if (!this->enabled()) {
+            for (auto i = std::size_t{0}; i < emissions; ++i)
+                deliver(sink, [] { return Result_type(); });
+            return;
+        }
+        this->record_emissions(emissions);
+        auto const collect = Collect_retired{*this};
+        auto const reader  = this->read_state();
+        auto const& state  = *reader.get();
+        auto dead          = std::size_t{0};
+        if (order == Batch_order::emission_major) {
+            for (auto const& args : batch) {
+#ifdef SIGNALS_ENABLE_TRACING
+                auto const trace = Trace_scope{
+                    name_.load(std::memory_order_relaxed), "emission"};
+#endif
+                deliver(sink, [&] {
+                    return std::apply(
+                        [&](auto&... a) {
+                            return call_combiner(state, dead, a...);
+                        },
+                        args);
+                });
+                this->notify_waiters_of(args);
+            }
+            dead /= std::max(emissions, std::size_t{1});
+        }
+        else {
+#ifdef SIGNALS_ENABLE_TRACING
+            auto const trace =
+                Trace_scope{name_.load(std::memory_order_relaxed), "batch"};
+#endif
+            auto const& slots = state.slots;
+            auto results      = Result_buffer<Ret>{emissions * slots.size()};
+            for (auto s = std::size_t{0}; s < slots.size(); ++s) {
+                auto const& connection = *slots[s];
+                if (!connection.connected() ||
+                    connection.get_slot().expired()) {
+                    connection.skipped(connection.connected()
+                                           ? Skip_reason::expired
+                                           : Skip_reason::disconnected,
+                                       emissions);
+                    ++dead;
+                    continue;
+                }
+                auto entry = s;
+                for (auto const& args : batch) {
+                    if (callable(connection)) {
+                        results.emplace(entry, [&]() -> Ret {
+                            return connection.call(args);
+                        });
+                    }
+                    entry += slots.size();
                 }
             }
-        };
-        // Bind arguments to all three types of connected Slots.
-        auto const lock = Lock_t{mtx_};
-        bind_slots(connections_.front);
-        for (auto& group : connections_.grouped)
-            bind_slots(group.second);
-        bind_slots(connections_.back);
-        return bound_slots;
+            auto e = std::size_t{0};
+            for (auto const& args : batch) {
+                auto const range =
+                    results.range(e * slots.size(), (e + 1) * slots.size());
+                deliver(sink, [&] {
+                    return invoke_combiner(state, range.first, range.second);
+                });
+                this->notify_waiters_of(args);
+                ++e;
+            }
+        }
+        this->reclaim(state, dead);
+    }
+
+    // Passes the result of \p emission to \p sink, if there is one.
+    template <typename Sink, typename Emission>
+    static void deliver(Sink& sink, Emission&& emission)
+    {
+        if constexpr (std::is_void_v<Result_type>) {
+            emission();
+            sink();
+        }
+        else
+            sink(emission());
+    }
+
+    // True if the Slot of \p connection can currently be called, otherwise
+    // counts why it is passed over.
+    static auto callable(Connection_impl_t const& connection) -> bool
+    {
+        if (!connection.connected())
+            connection.skipped(Skip_reason::disconnected);
+        else if (connection.get_slot().expired())
+            connection.skipped(Skip_reason::expired);
+        else if (connection.blocked())
+            connection.skipped(Skip_reason::blocked);
+        else
+            return true;
+        return false;
+    }
+
+    // Takes the trace name of \p other, a no-op unless SIGNALS_ENABLE_TRACING
+    // is defined.
+    void copy_name([[maybe_unused]] Signal const& other)
+    {
+#ifdef SIGNALS_ENABLE_TRACING
+        name_.store(other.name_.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+#endif
+    }
+
+    // Counts \p count emissions, a no-op unless SIGNALS_ENABLE_STATS is
+    // defined.
+    void record_emissions([[maybe_unused]] std::size_t count) const
+    {
+#ifdef SIGNALS_ENABLE_STATS
+        emissions_.fetch_add(count, std::memory_order_relaxed);
+#endif
+    }
+
+    // Moves the emission count and the totals of erased connections of \p
+    // other to *this, leaving those of \p other at zero. Must be called with
+    // both mutexes held, a no-op unless SIGNALS_ENABLE_STATS is defined.
+    void take_totals([[maybe_unused]] Signal& other)
+    {
+#ifdef SIGNALS_ENABLE_STATS
+        emissions_.store(other.emissions_.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+        retired_ = std::move(other.retired_);
+        other.clear_totals();
+#endif
+    }
+
+    // Sets the emission count and the totals of erased connections to zero.
+    // Must be called with mtx_ held, a no-op unless SIGNALS_ENABLE_STATS is
+    // defined.
+    void clear_totals()
+    {
+#ifdef SIGNALS_ENABLE_STATS
+        retired_ = Signal_stats{};
+        emissions_.store(0, std::memory_order_relaxed);
+#endif
+    }
+
+    // Adds the counters of \p connection, about to be erased, to retired_.
+    // Must be called with mtx_ held, a no-op unless SIGNALS_ENABLE_STATS is
+    // defined.
+    void retire([[maybe_unused]] Connection_impl_t const& connection) const
+    {
+#ifdef SIGNALS_ENABLE_STATS
+        retired_ += connection.recorder().snapshot();
+#endif
+    }
+
+    // Resumes coroutines awaiting the next emission with a copy of \p args.
+    template <typename... Params>
+    void notify_waiters([[maybe_unused]] Params&... args) const
+    {
+#ifdef SIGNALS_ENABLE_COROUTINES
+        waiters_.notify(args...);
+#endif
+    }
+
+    // notify_waiters() with the elements of the tuple-like \p args.
+    template <typename Tuple>
+    void notify_waiters_of([[maybe_unused]] Tuple const& args) const
+    {
+#ifdef SIGNALS_ENABLE_COROUTINES
+        std::apply([this](auto&... a) { this->notify_waiters(a...); }, args);
+#endif
+    }
+
+    // Compacts connections_ once at least half of the emitted snapshot \p
+    // state was found dead, which keeps reclamation amortized constant per
+    // disconnect. Never blocks, if mtx_ is busy a later emission retries.
+    void reclaim(Emission_state const& state, std::size_t dead) const
+    {
+        if (dead == 0 || dead * 2 < state.slots.size())
+            return;
+        auto const lock = std::unique_lock{mtx_, std::try_to_lock};
+        if (!lock.owns_lock() || snapshot_.get() != &state)
+            return;
+        this->publish();
+    }
+
+    // Destroys the snapshots retired while emissions were reading them, once
+    // none is left that could. Never blocks, if mtx_ is busy a later emission
+    // retries.
+    void collect_retired() const
+    {
+        if (!snapshot_.has_retired())
+            return;
+        auto const lock = std::unique_lock{mtx_, std::try_to_lock};
+        if (lock.owns_lock())
+            snapshot_.collect();
     }
 };
 
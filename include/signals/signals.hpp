@@ -1,13 +1,25 @@
 #ifndef SIGNALS_SIGNALS_HPP
 #define SIGNALS_SIGNALS_HPP
 
+#include "batch_order.hpp"
+#include "combiners.hpp"
 #include "connection.hpp"
+#include "connection_handle.hpp"
+#include "connection_pool.hpp"
+#include "dispatcher.hpp"
 #include "expired_slot.hpp"
+#include "inplace_function.hpp"
+#include "move_only_arguments.hpp"
 #include "position.hpp"
 #include "shared_connection_block.hpp"
 #include "signal.hpp"
 #include "signal_fwd.hpp"
 #include "slot.hpp"
+#include "static_signal.hpp"
 #include "slot_fwd.hpp"
+#include "stats.hpp"
+#include "thread_pool.hpp"
+#include "threading.hpp"
+#include "tracer.hpp"
 
 #endif  // SIGNALS_SIGNALS_HPP
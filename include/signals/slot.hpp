@@ -4,6 +4,7 @@
 #include <iterator>
 #include <memory>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include "expired_slot.hpp"
@@ -13,11 +14,24 @@
 
 namespace sig {
 
+// True if T is a Signal, which Slot stores and tracks at the same time.
+template <typename T>
+inline constexpr bool is_signal_v = false;
+
+template <typename T,
+          typename U,
+          typename V,
+          typename W,
+          typename X,
+          typename Y>
+inline constexpr bool is_signal_v<Signal<T, U, V, W, X, Y>> = true;
+
 /// Represents a function that can be connected to a Signal.
 /** Slots can track other objects to mirror their lifetime. If one tracked
  *  object is destroyed, *this will no longer be called by any Signal. Slots
  *  can be called like any other function, with operator(). Is _not_ nothrow
- *  move constructible/assignable because std::function is not.
+ *  move constructible/assignable because std::function is not. Is move-only
+ *  if FunctionType is move-only, see Inplace_function.
  *  \param R Return type of the function.
  *  \param Args... Argument types to the function.
  *  \param FunctionType Internally held type where function will be stored. */
@@ -47,6 +61,19 @@ class Slot<R(Args...), FunctionType> : public Slot_base {
         : function_{function}
     {}
 
+    /// Construct from any rvalue convertible to FunctionType.
+    /** Moves \p function into the FunctionType object, so move-only callables
+     *  can be stored when FunctionType supports them.
+     *  \p function Function pointer, lambda, functor, etc... to be stored. */
+    template <typename F,
+              typename = std::enable_if_t<
+                  !std::is_lvalue_reference_v<F> &&
+                  !std::is_base_of_v<Slot_base, F> && !is_signal_v<F>>>
+    Slot(F&& function) noexcept(
+        noexcept(Slot_function_t{std::move(function)}))
+        : function_{std::move(function)}
+    {}
+
     /// Constructs from a Signal, automatically tracks the Signal.
     /// \param sig Signal stored in *this. Requires same signature as *this.
     template <typename T,
@@ -63,15 +90,21 @@ class Slot<R(Args...), FunctionType> : public Slot_base {
    public:
     /// Call underlying function if no tracked objects are expired.
     /** Passes on args... to the FunctionType object. No-op if any tracked
-     *  objects no longer exist. Throws std::bad_function_call if Slot is empty.
+     *  objects no longer exist, returning a value initialized Result_t, or
+     *  throwing Expired_slot if Result_t is a reference or not default
+     *  constructible. Throws std::bad_function_call if Slot is empty.
      *  \param args... Arguments passed onto the underlying function.
      *  \param Result_t The value returned by the function call. */
     template <typename... Arguments>
     auto operator()(Arguments&&... args) const -> Result_t
     {
-        if (this->expired())
-            return Result_t();
-        auto const l = this->lock();
+        auto const pinned = this->pin();
+        if (!pinned) {
+            if constexpr (std::is_default_constructible_v<Result_t>)
+                return Result_t();
+            else
+                throw Expired_slot();
+        }
         return function_(std::forward<Arguments>(args)...);
     }
 
@@ -79,7 +112,9 @@ class Slot<R(Args...), FunctionType> : public Slot_base {
     template <typename... Arguments>
     auto call(Arguments&&... args) const -> Result_t
     {
-        auto const l = this->expired() ? throw Expired_slot() : this->lock();
+        auto const pinned = this->pin();
+        if (!pinned)
+            throw Expired_slot();
         return function_(std::forward<Arguments>(args)...);
     }
 
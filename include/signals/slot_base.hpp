@@ -1,6 +1,8 @@
 #ifndef SIGNALS_SLOT_BASE_HPP
 #define SIGNALS_SLOT_BASE_HPP
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <vector>
@@ -13,6 +15,26 @@ class Slot_base {
     using Locked_container_t  = std::vector<std::shared_ptr<void>>;
     using Tracked_container_t = std::vector<std::weak_ptr<void>>;
 
+    /// Keeps tracked objects alive for the duration of a Slot call.
+    /** Up to inline_capacity objects are held inline, only a Slot tracking
+     *  more than that spills to the heap. Converts to false if any tracked
+     *  object had already expired, in which case nothing is held. */
+    class Pin {
+       public:
+        static constexpr std::size_t inline_capacity = 4;
+
+       public:
+        /// \returns True if every tracked object was alive and is now held.
+        explicit operator bool() const { return !expired_; }
+
+       private:
+        std::array<std::shared_ptr<void>, inline_capacity> inline_;
+        std::vector<std::shared_ptr<void>> overflow_;
+        bool expired_ = false;
+
+        friend class Slot_base;
+    };
+
    public:
     Slot_base()                 = default;
     Slot_base(Slot_base const&) = default;
@@ -42,6 +64,29 @@ class Slot_base {
         return locked_vec;
     }
 
+    /// Checks for expired tracked objects and locks them in a single pass.
+    /** Does not allocate unless more than Pin::inline_capacity objects are
+     *  tracked.
+     *  \returns Pin holding every tracked object, false if any had expired. */
+    auto pin() const -> Pin
+    {
+        auto pinned = Pin{};
+        auto index  = std::size_t{0};
+        for (auto const& tracked : tracked_ptrs_) {
+            auto locked = tracked.lock();
+            if (locked == nullptr) {
+                auto expired     = Pin{};
+                expired.expired_ = true;
+                return expired;
+            }
+            if (index < Pin::inline_capacity)
+                pinned.inline_[index++] = std::move(locked);
+            else
+                pinned.overflow_.push_back(std::move(locked));
+        }
+        return pinned;
+    }
+
     /// \returns The internally held container of tracked objects.
     auto get_tracked_container() const -> Tracked_container_t const&
     {
@@ -0,0 +1,186 @@
+/// \file
+/// Signal with a Slot list fixed at compile time.
+#ifndef SIGNALS_STATIC_SIGNAL_HPP
+#define SIGNALS_STATIC_SIGNAL_HPP
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "detail/function_type_splitter.hpp"
+#include "detail/static_slot_iterator.hpp"
+#include "optional_last_value.hpp"
+
+namespace sig {
+
+template <typename Signature, typename Combiner, typename... Slots>
+class Basic_static_signal;
+
+/// Signal whose Slots are fixed by its type.
+/** Each Slot is a callable object of its own type stored inside the Signal,
+ *  there is no std::function, no connection object, no lock and no allocation,
+ *  and every Slot call can be inlined at the emission. Slots are called in the
+ *  order they are listed. With the default Optional_last_value Combiner the
+ *  Slot calls are a plain sequence of direct calls, any other Combiner is
+ *  given input iterators over the Slots, as with Signal. Thread safe as long
+ *  as the Slots and the Combiner are.
+ *  \param Signature Function type of the Signal, Ret(Args...).
+ *  \param Combiner Combines the Slot results, as for Signal.
+ *  \param Slots Callable types, each invocable with Args... and returning
+ *  something convertible to Ret.
+ *  \sa Static_signal make_static_signal Signal */
+template <typename Ret, typename... Args, typename Combiner, typename... Slots>
+class Basic_static_signal<Ret(Args...), Combiner, Slots...> {
+    static_assert((std::is_invocable_r_v<Ret, Slots&, Args&...> && ...),
+                  "Every Slot must be callable with the Signal's arguments.");
+
+   public:
+    using Result_type = typename Combiner::Result_type;
+    using Signature   = Ret(Args...);
+    using Arguments   = std::tuple<Args...>;
+
+    /// Number of arguments the Signal takes.
+    static constexpr int arity = std::tuple_size_v<Arguments>;
+
+    /// Access to the type of argument number \p N.
+    template <std::size_t N>
+    using arg = typename std::tuple_element_t<N, Arguments>;
+
+   public:
+    /// Default constructs every Slot and the Combiner.
+    template <bool Has_slots = (sizeof...(Slots) > 0),
+              typename       = std::enable_if_t<Has_slots>>
+    Basic_static_signal() : slots_{}, combiner_{}
+    {}
+
+    /// Constructs the Signal from its Slots and a Combiner.
+    /** \param slots One object of each Slot type, in call order.
+     *  \param combiner Slot return value combiner object. */
+    explicit Basic_static_signal(Slots... slots,
+                                 Combiner const& combiner = Combiner())
+        : slots_{std::move(slots)...}, combiner_{combiner}
+    {}
+
+   public:
+    /// Call every Slot with \p args.
+    /** \param args The arguments you are passing onto the Slots.
+     *  \returns A value determined by the Combiner. */
+    template <typename... Params>
+    auto operator()(Params&&... args) -> Result_type
+    {
+        return this->emit(slots_, args...);
+    }
+
+    /// Call every Slot with \p args, each Slot called as const.
+    template <typename... Params>
+    auto operator()(Params&&... args) const -> Result_type
+    {
+        return this->emit(slots_, args...);
+    }
+
+    /// Access the number of Slots, fixed by the type.
+    static constexpr auto num_slots() -> std::size_t
+    {
+        return sizeof...(Slots);
+    }
+
+    /// Access to the Combiner object.
+    /** \returns A copy of the Combiner object used by *this. */
+    auto combiner() const -> Combiner { return combiner_; }
+
+    /// Set the Combiner object to a new value.
+    void set_combiner(Combiner const& comb) { combiner_ = comb; }
+
+    /// Access to the Slot at position \p I.
+    template <std::size_t I>
+    auto slot() -> std::tuple_element_t<I, std::tuple<Slots...>>&
+    {
+        return std::get<I>(slots_);
+    }
+
+    /// Access to the Slot at position \p I.
+    template <std::size_t I>
+    auto slot() const -> std::tuple_element_t<I, std::tuple<Slots...>> const&
+    {
+        return std::get<I>(slots_);
+    }
+
+   private:
+    std::tuple<Slots...> slots_;
+    Combiner combiner_;
+
+   private:
+    // Calls \p slots with \p args bound by reference through the Combiner.
+    // Optional_last_value is folded over the Slots directly.
+    template <typename Tuple, typename... Params>
+    auto emit(Tuple& slots, Params&... args) const -> Result_type
+    {
+        if constexpr (std::is_same_v<Combiner, Optional_last_value<Ret>>)
+            return last_value(slots, std::index_sequence_for<Slots...>{},
+                              args...);
+        else {
+            using Bound_args = std::tuple<Params&...>;
+            using Iter       = Static_slot_iterator<Ret, Tuple, Bound_args>;
+            auto const bound = Bound_args{args...};
+            auto first       = Iter{slots, bound, 0};
+            auto last        = Iter{slots, bound, sizeof...(Slots)};
+            if constexpr (std::is_invocable_v<Combiner const&, Iter, Iter>)
+                return combiner_(first, last);
+            else
+                return Combiner{combiner_}(first, last);
+        }
+    }
+
+    // Calls every Slot, only the result of the last one is kept, constructed
+    // in place in the optional.
+    template <typename Tuple, std::size_t... Is, typename... Params>
+    static auto last_value(Tuple& slots,
+                           std::index_sequence<Is...>,
+                           Params&... args) -> Result_type
+    {
+        if constexpr (std::is_void_v<Ret>)
+            (static_cast<void>(std::get<Is>(slots)(args...)), ...);
+        else {
+            auto result = Result_type{};
+            if constexpr (sizeof...(Is) != 0) {
+                constexpr auto last = sizeof...(Is) - 1;
+                call_leading(slots, std::make_index_sequence<last>{},
+                             args...);
+                result.emplace(std::get<last>(slots)(args...));
+            }
+            return result;
+        }
+    }
+
+    // Calls the Slots at \p Is, discarding their results.
+    template <typename Tuple, std::size_t... Is, typename... Params>
+    static void call_leading(Tuple& slots,
+                             std::index_sequence<Is...>,
+                             Params&... args)
+    {
+        (static_cast<void>(std::get<Is>(slots)(args...)), ...);
+    }
+};
+
+/// Basic_static_signal using the default Optional_last_value Combiner.
+/** \sa Basic_static_signal make_static_signal */
+template <typename Signature, typename... Slots>
+using Static_signal = Basic_static_signal<
+    Signature,
+    Optional_last_value<typename Function_type_splitter<Signature>::Return_t>,
+    Slots...>;
+
+/// Builds a Static_signal calling \p slots, in order.
+/** Useful for lambdas, whose types cannot be named.
+ *  \param slots Callable objects, copied or moved into the Static_signal.
+ *  \returns A Static_signal with one Slot per element of \p slots. */
+template <typename Signature, typename... Fs>
+auto make_static_signal(Fs&&... slots)
+    -> Static_signal<Signature, std::decay_t<Fs>...>
+{
+    return Static_signal<Signature, std::decay_t<Fs>...>{
+        std::forward<Fs>(slots)...};
+}
+
+}  // namespace sig
+#endif  // SIGNALS_STATIC_SIGNAL_HPP
@@ -0,0 +1,118 @@
+/// \file
+/// Emission and Slot statistics, recorded when SIGNALS_ENABLE_STATS is set.
+#ifndef SIGNALS_STATS_HPP
+#define SIGNALS_STATS_HPP
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "connection_handle.hpp"
+
+namespace sig {
+
+/// Call durations counted in power of two buckets of nanoseconds.
+struct Latency_histogram {
+    /// Number of buckets, the last one also counts every longer call.
+    static constexpr std::size_t bucket_count = 32;
+
+    /// buckets[i] counts calls that took [2^i, 2^(i+1)) nanoseconds, bucket
+    /// zero also counts calls under a nanosecond.
+    std::array<std::uint64_t, bucket_count> buckets = {};
+
+    /// \returns The number of calls counted.
+    auto count() const -> std::uint64_t
+    {
+        auto total = std::uint64_t{0};
+        for (auto const n : buckets)
+            total += n;
+        return total;
+    }
+
+    /// Upper bound of the quantile \p q of call durations.
+    /** \param q In [0, 1], 0.5 for the median, 0.99 for the 99th percentile.
+     *  \returns The end of the bucket the quantile falls in, zero if no call
+     *  was counted. */
+    auto quantile(double q) const -> std::chrono::nanoseconds
+    {
+        auto const total = this->count();
+        if (total == 0)
+            return std::chrono::nanoseconds{0};
+        auto const rank = static_cast<std::uint64_t>(q * (total - 1)) + 1;
+        auto seen       = std::uint64_t{0};
+        auto i          = std::size_t{0};
+        for (; i + 1 < bucket_count; ++i) {
+            seen += buckets[i];
+            if (seen >= rank)
+                break;
+        }
+        return std::chrono::nanoseconds{std::int64_t{2} << i};
+    }
+
+    auto operator+=(Latency_histogram const& x) -> Latency_histogram&
+    {
+        for (auto i = std::size_t{0}; i < bucket_count; ++i)
+            buckets[i] += x.buckets[i];
+        return *this;
+    }
+};
+
+/// What happened to one connection across the emissions of its Signal.
+struct Slot_stats {
+    /// The connection these statistics belong to.
+    Connection_handle connection;
+
+    /// Number of times the Slot was called.
+    std::uint64_t invoked = 0;
+
+    /// Number of emissions that passed over the Slot while it was blocked.
+    std::uint64_t skipped_blocked = 0;
+
+    /// Number of emissions that passed over the Slot after it disconnected.
+    std::uint64_t skipped_disconnected = 0;
+
+    /// Number of emissions that passed over the Slot once a tracked object
+    /// expired.
+    std::uint64_t skipped_expired = 0;
+
+    /// Durations of the Slot calls.
+    Latency_histogram latency;
+};
+
+/// Statistics of a Signal, returned by Signal::stats().
+/** Counts are totals since the Signal was constructed or its statistics were
+ *  last reset, including connections that are gone by now. */
+struct Signal_stats {
+    /// Number of emissions, a batch counts each of its elements.
+    std::uint64_t emissions = 0;
+
+    /// Number of Slot calls.
+    std::uint64_t invoked = 0;
+
+    /// Number of times an emission passed over a blocked Slot.
+    std::uint64_t skipped_blocked = 0;
+
+    /// Number of times an emission passed over a disconnected Slot.
+    std::uint64_t skipped_disconnected = 0;
+
+    /// Number of times an emission passed over a Slot with an expired tracked
+    /// object.
+    std::uint64_t skipped_expired = 0;
+
+    /// Statistics of each connected Slot, in call order.
+    std::vector<Slot_stats> slots;
+
+    /// Adds the counts of \p slot to the totals, leaves slots alone.
+    auto operator+=(Slot_stats const& slot) -> Signal_stats&
+    {
+        invoked              += slot.invoked;
+        skipped_blocked      += slot.skipped_blocked;
+        skipped_disconnected += slot.skipped_disconnected;
+        skipped_expired      += slot.skipped_expired;
+        return *this;
+    }
+};
+
+}  // namespace sig
+#endif  // SIGNALS_STATS_HPP
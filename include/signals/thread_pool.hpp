@@ -0,0 +1,96 @@
+/// \file
+/// Fixed size thread pool, the built-in executor for Signal::emit_async.
+#ifndef SIGNALS_THREAD_POOL_HPP
+#define SIGNALS_THREAD_POOL_HPP
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "inplace_function.hpp"
+
+namespace sig {
+
+/// Runs submitted tasks on a fixed number of worker threads.
+/** Tasks are started in the order they were submitted. Any type with an
+ *  execute member function taking a move-only nullary callable can stand in
+ *  for a Thread_pool as the executor of Signal::emit_async.
+ *  \sa Signal::emit_async */
+class Thread_pool {
+   public:
+    /// Move-only unit of work run by the pool.
+    using Task = Inplace_function<void()>;
+
+   public:
+    /// Starts \p thread_count worker threads, at least one.
+    explicit Thread_pool(
+        std::size_t thread_count = std::thread::hardware_concurrency())
+    {
+        thread_count = std::max(thread_count, std::size_t{1});
+        workers_.reserve(thread_count);
+        for (auto i = std::size_t{0}; i < thread_count; ++i)
+            workers_.emplace_back([this] { this->run(); });
+    }
+
+    Thread_pool(Thread_pool const&) = delete;
+
+    auto operator=(Thread_pool const&) -> Thread_pool& = delete;
+
+    /// Runs every task already submitted, then joins the worker threads.
+    ~Thread_pool()
+    {
+        {
+            auto const lock = std::scoped_lock{mtx_};
+            stopping_       = true;
+        }
+        ready_.notify_all();
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+   public:
+    /// Queues \p task to be run on one of the worker threads.
+    /** Exceptions thrown by \p task are not caught, tasks that can fail should
+     *  report through a promise or similar, as emit_async does. */
+    void execute(Task task)
+    {
+        {
+            auto const lock = std::scoped_lock{mtx_};
+            tasks_.push_back(std::move(task));
+        }
+        ready_.notify_one();
+    }
+
+    /// \returns The number of worker threads.
+    auto size() const -> std::size_t { return workers_.size(); }
+
+   private:
+    std::mutex mtx_;
+    std::condition_variable ready_;
+    std::deque<Task> tasks_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+   private:
+    // Worker loop, returns once stopping and the queue is drained.
+    void run()
+    {
+        while (true) {
+            auto lock = std::unique_lock{mtx_};
+            ready_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty())
+                return;
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            task();
+        }
+    }
+};
+
+}  // namespace sig
+#endif  // SIGNALS_THREAD_POOL_HPP
@@ -0,0 +1,109 @@
+/// \file
+/// Threading policies selected by the Mutex parameter of a Signal.
+#ifndef SIGNALS_THREADING_HPP
+#define SIGNALS_THREADING_HPP
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "detail/unsynchronized.hpp"
+
+namespace sig {
+
+/// Mutex that does nothing, for Signals that are only used from one thread.
+/** Selects the Single_threaded policy when used as the Mutex of a Signal. */
+class Null_mutex {
+   public:
+    void lock() {}
+
+    void unlock() {}
+
+    auto try_lock() -> bool { return true; }
+};
+
+/// Default policy, every shared state change is atomic.
+struct Multi_threaded {
+    /// Holds connection state and Signal flags.
+    template <typename T>
+    using Atomic = std::atomic<T>;
+
+    /// Guards the connection table of a Signal.
+    using Mutex = std::mutex;
+
+    /// Reads a published shared_ptr.
+    template <typename T>
+    static auto load_shared(std::shared_ptr<T> const* p) -> std::shared_ptr<T>
+    {
+        return std::atomic_load(p);
+    }
+
+    /// Publishes a shared_ptr.
+    template <typename T>
+    static void store_shared(std::shared_ptr<T>* p, std::shared_ptr<T> r)
+    {
+        std::atomic_store(p, std::move(r));
+    }
+
+    /// Publishes a shared_ptr and returns the one it replaced.
+    template <typename T>
+    static auto exchange_shared(std::shared_ptr<T>* p, std::shared_ptr<T> r)
+        -> std::shared_ptr<T>
+    {
+        return std::atomic_exchange(p, std::move(r));
+    }
+};
+
+/// Policy for objects never shared between threads.
+/** Connection state, connection tables, snapshot publication and Signal
+ *  flags use plain loads and stores and no locks. Reference counts of the
+ *  std::shared_ptr and std::weak_ptr owning connections and snapshots are
+ *  still atomic, the policy does not replace them. */
+struct Single_threaded {
+    /// Holds connection state and Signal flags.
+    template <typename T>
+    using Atomic = Unsynchronized<T>;
+
+    /// Guards the connection table of a Signal.
+    using Mutex = Null_mutex;
+
+    /// Reads a published shared_ptr.
+    template <typename T>
+    static auto load_shared(std::shared_ptr<T> const* p) -> std::shared_ptr<T>
+    {
+        return *p;
+    }
+
+    /// Publishes a shared_ptr.
+    template <typename T>
+    static void store_shared(std::shared_ptr<T>* p, std::shared_ptr<T> r)
+    {
+        *p = std::move(r);
+    }
+
+    /// Publishes a shared_ptr and returns the one it replaced.
+    template <typename T>
+    static auto exchange_shared(std::shared_ptr<T>* p, std::shared_ptr<T> r)
+        -> std::shared_ptr<T>
+    {
+        return std::exchange(*p, std::move(r));
+    }
+};
+
+/// Maps the Mutex type of a Signal to its threading policy.
+/** Multi_threaded for every Mutex except Null_mutex. Specialize this for a
+ *  custom no-op mutex to get the Single_threaded policy. The policy is used by
+ *  the Signal and by each of its connections, so Connection and
+ *  Shared_connection_block operations on them are unsynchronized as well. */
+template <typename Mutex>
+struct Threading_policy {
+    using type = Multi_threaded;
+};
+
+template <>
+struct Threading_policy<Null_mutex> {
+    using type = Single_threaded;
+};
+
+}  // namespace sig
+#endif  // SIGNALS_THREADING_HPP
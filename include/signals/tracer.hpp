@@ -0,0 +1,305 @@
+/// \file
+/// Records emissions and Slot calls as Chrome trace events.
+#ifndef SIGNALS_TRACER_HPP
+#define SIGNALS_TRACER_HPP
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace sig {
+
+/// Collects begin and end events into per-thread buffers.
+/** When the library is compiled with SIGNALS_ENABLE_TRACING, Signal::operator()
+ *  and every Slot call record a begin and an end event while the Tracer is
+ *  active, named after Signal::set_name() and Signal::set_slot_label(). While
+ *  inactive, each hook costs one relaxed atomic load. Each thread appends to
+ *  its own fixed size buffer without locking. Once a buffer is full, further
+ *  events on that thread are dropped and counted. The events can be written
+ *  out at any time as JSON in the Chrome trace-event format, which
+ *  chrome://tracing and ui.perfetto.dev open.
+ *  \sa Trace_scope */
+class Tracer {
+   public:
+    /// The Tracer of the process, never destroyed.
+    static auto instance() -> Tracer&
+    {
+        static auto* const tracer = new Tracer;
+        return *tracer;
+    }
+
+    Tracer(Tracer const&) = delete;
+
+    auto operator=(Tracer const&) -> Tracer& = delete;
+
+   public:
+    /// Discards the events recorded so far and starts recording.
+    /** \param events_per_thread Capacity of each thread's buffer. */
+    void start(std::size_t events_per_thread = 65'536)
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        buffers_.clear();
+        capacity_ = events_per_thread;
+        origin_.store(nanoseconds(), std::memory_order_release);
+        session_.fetch_add(1, std::memory_order_release);
+        active_.store(true, std::memory_order_release);
+    }
+
+    /// Stops recording, the events recorded so far are kept.
+    /** Trace_scopes still open record their end regardless, so that every
+     *  begin event written out is matched. */
+    void stop() { active_.store(false, std::memory_order_release); }
+
+    /// Query whether events are being recorded.
+    auto active() const -> bool
+    {
+        return active_.load(std::memory_order_relaxed);
+    }
+
+    /// Records the beginning of \p name on the calling thread.
+    /** \param name Must outlive the Tracer's events, see intern().
+     *  \param category Must be a string literal. */
+    void begin(char const* name, char const* category)
+    {
+        this->record(name, category, 'B');
+    }
+
+    /// Records the end of \p name on the calling thread.
+    void end(char const* name, char const* category)
+    {
+        this->record(name, category, 'E');
+    }
+
+    /// Copy of \p name that lives as long as the process.
+    /** Equal names share a single copy. */
+    auto intern(std::string_view name) -> char const*
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        return names_.emplace(name).first->c_str();
+    }
+
+    /// \returns The number of events dropped because a buffer was full.
+    auto dropped() const -> std::size_t
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        auto count      = std::size_t{0};
+        for (auto const& buffer : buffers_)
+            count += buffer->dropped.load(std::memory_order_relaxed);
+        return count;
+    }
+
+    /// Writes every event recorded since start() as a JSON trace.
+    /** Safe while threads are still recording, their later events are left
+     *  out. */
+    void write_json(std::ostream& out) const
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        out << "{\"traceEvents\":[";
+        auto first = true;
+        for (auto const& buffer : buffers_) {
+            auto const size = buffer->size.load(std::memory_order_acquire);
+            for (auto i = std::size_t{0}; i < size; ++i) {
+                auto const& event = buffer->events[i];
+                out << (first ? "\n" : ",\n") << "{\"name\":\"";
+                write_escaped(out, event.name);
+                out << "\",\"cat\":\"" << event.category << "\",\"ph\":\""
+                    << event.phase << "\",\"ts\":";
+                write_microseconds(out, event.time);
+                out << ",\"pid\":1,\"tid\":" << buffer->thread << '}';
+                first = false;
+            }
+        }
+        out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+    /// Writes the JSON trace to the file at \p path.
+    /** \throws std::runtime_error If the file cannot be written. */
+    void save(std::string const& path) const
+    {
+        auto file = std::ofstream{path};
+        this->write_json(file);
+        file.close();
+        if (!file)
+            throw std::runtime_error{"Tracer could not write " + path};
+    }
+
+   private:
+    friend class Trace_scope;
+
+    struct Event {
+        char const* name;
+        char const* category;
+        std::int64_t time;  // Nanoseconds since start().
+        char phase;
+    };
+
+    // Written only by its thread, read by write_json() up to size.
+    struct Buffer {
+        explicit Buffer(std::size_t capacity, std::uint64_t thread_id)
+            : events{std::make_unique<Event[]>(capacity)},
+              capacity{capacity},
+              thread{thread_id}
+        {}
+
+        std::unique_ptr<Event[]> events;
+        std::size_t const capacity;
+        std::uint64_t const thread;
+        std::atomic<std::size_t> size    = 0;
+        std::atomic<std::size_t> dropped = 0;
+    };
+
+    // The calling thread's buffer for the current session.
+    struct Local {
+        std::shared_ptr<Buffer> buffer;
+        std::uint64_t session = 0;
+    };
+
+   private:
+    std::atomic<bool> active_           = false;
+    std::atomic<std::uint64_t> session_ = 0;
+    std::atomic<std::int64_t> origin_   = 0;  // Steady clock at start().
+    std::size_t capacity_               = 0;
+    std::uint64_t thread_ids_           = 0;
+    std::vector<std::shared_ptr<Buffer>> buffers_;
+    std::unordered_set<std::string> names_;
+    mutable std::mutex mtx_;
+
+   private:
+    Tracer() = default;
+
+    // Records the event while active. \returns The session it was recorded
+    // in, zero if it was not.
+    auto record(char const* name, char const* category, char phase)
+        -> std::uint64_t
+    {
+        if (!this->active())
+            return 0;
+        auto& local = this->local_buffer();
+        this->append(*local.buffer, name, category, phase);
+        return local.session;
+    }
+
+    // Records the end of a scope whose begin was recorded in \p session,
+    // whether or not the Tracer is still active. Nothing is recorded if the
+    // thread's buffer was replaced by a later start() since.
+    void close(char const* name, char const* category, std::uint64_t session)
+    {
+        auto& local = local_state();
+        if (local.session == session)
+            this->append(*local.buffer, name, category, 'E');
+    }
+
+    void append(Buffer& buffer,
+                char const* name,
+                char const* category,
+                char phase)
+    {
+        auto const i = buffer.size.load(std::memory_order_relaxed);
+        if (i == buffer.capacity) {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        // The origin is read before the clock, and no earlier than the
+        // session of the buffer, so a start() running concurrently cannot
+        // make the time negative. Clamped all the same, events must not
+        // predate their trace.
+        auto const origin = origin_.load(std::memory_order_acquire);
+        auto const time   = std::max(nanoseconds() - origin, std::int64_t{0});
+        buffer.events[i]  = Event{name, category, time, phase};
+        buffer.size.store(i + 1, std::memory_order_release);
+    }
+
+    // Registers a new buffer the first time a thread records in a session.
+    auto local_buffer() -> Local&
+    {
+        auto& local        = local_state();
+        auto const session = session_.load(std::memory_order_acquire);
+        if (local.session != session) {
+            auto const lock = std::scoped_lock{mtx_};
+            local.buffer  = std::make_shared<Buffer>(capacity_, ++thread_ids_);
+            local.session = session;
+            buffers_.push_back(local.buffer);
+        }
+        return local;
+    }
+
+    static auto local_state() -> Local&
+    {
+        thread_local auto local = Local{};
+        return local;
+    }
+
+    static auto nanoseconds() -> std::int64_t
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    static void write_escaped(std::ostream& out, char const* text)
+    {
+        constexpr char const* hex = "0123456789abcdef";
+        for (; *text != '\0'; ++text) {
+            auto const c = static_cast<unsigned char>(*text);
+            if (c == '"' || c == '\\')
+                out << '\\' << *text;
+            else if (c < 0x20)
+                out << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+            else
+                out << *text;
+        }
+    }
+
+    // Writes \p ns as microseconds with a three digit fraction.
+    static void write_microseconds(std::ostream& out, std::int64_t ns)
+    {
+        if (ns < 0) {
+            out << '-';
+            ns = -ns;
+        }
+        auto const fraction = std::to_string(ns % 1'000);
+        out << ns / 1'000 << '.' << std::string(3 - fraction.size(), '0')
+            << fraction;
+    }
+};
+
+/// Records a begin event on construction, if the Tracer is active, and the
+/// matching end event on destruction, even if the Tracer was stopped since.
+class Trace_scope {
+   public:
+    /// \param name Must outlive the recorded events, see Tracer::intern().
+    /// \param category Must be a string literal.
+    Trace_scope(char const* name, char const* category)
+        : name_{name},
+          category_{category},
+          session_{Tracer::instance().record(name, category, 'B')}
+    {}
+
+    Trace_scope(Trace_scope const&) = delete;
+
+    auto operator=(Trace_scope const&) -> Trace_scope& = delete;
+
+    ~Trace_scope()
+    {
+        if (session_ != 0)
+            Tracer::instance().close(name_, category_, session_);
+    }
+
+   private:
+    char const* name_;
+    char const* category_;
+    std::uint64_t session_;  // Of the begin event, zero if none.
+};
+
+}  // namespace sig
+#endif  // SIGNALS_TRACER_HPP
@@ -0,0 +1,216 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+
+#include <signals/connection.hpp>
+#include <signals/dispatcher.hpp>
+#include <signals/inplace_function.hpp>
+#include <signals/optional_last_value.hpp>
+#include <signals/position.hpp>
+#include <signals/signal.hpp>
+#include <signals/slot.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Connection;
+using sig::Dispatcher;
+using sig::Inplace_function;
+using sig::Optional_last_value;
+using sig::Position;
+using sig::Signal;
+using sig::Slot;
+
+namespace {
+
+std::atomic<std::size_t> allocation_count{0};
+
+auto counted_alloc(std::size_t size) noexcept -> void*
+{
+    ++allocation_count;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+auto counted_alloc(std::size_t size, std::align_val_t align) noexcept -> void*
+{
+    ++allocation_count;
+    auto const alignment = static_cast<std::size_t>(align);
+    auto const rounded   = (size + alignment - 1) / alignment * alignment;
+    return std::aligned_alloc(alignment, rounded == 0 ? alignment : rounded);
+}
+
+template <typename... Align>
+auto throwing_alloc(std::size_t size, Align... align) -> void*
+{
+    if (void* p = counted_alloc(size, align...))
+        return p;
+    throw std::bad_alloc{};
+}
+
+}  // namespace
+
+// Counting allocator for this test binary, used to verify that emission does
+// not touch the heap. Every overload is replaced, so that memory is never
+// allocated by one allocator and freed by another, sanitizers check for that.
+void* operator new(std::size_t size) { return throwing_alloc(size); }
+
+void* operator new[](std::size_t size) { return throwing_alloc(size); }
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+    return counted_alloc(size);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept
+{
+    return counted_alloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+    return throwing_alloc(size, align);
+}
+
+void* operator new[](std::size_t size, std::align_val_t align)
+{
+    return throwing_alloc(size, align);
+}
+
+void* operator new(std::size_t size,
+                   std::align_val_t align,
+                   std::nothrow_t const&) noexcept
+{
+    return counted_alloc(size, align);
+}
+
+void* operator new[](std::size_t size,
+                     std::align_val_t align,
+                     std::nothrow_t const&) noexcept
+{
+    return counted_alloc(size, align);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete[](void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete(void* p, std::nothrow_t const&) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p,
+                       std::align_val_t,
+                       std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+TEST_CASE("Signal::operator() does not allocate", "[signal]")
+{
+    Signal<int(std::string const&, int)> sig;
+    auto total = 0;
+    for (auto i = 0; i < 10; ++i) {
+        sig.connect([&total, i](std::string const& s, int x) {
+            total += x;
+            return static_cast<int>(s.size()) + i;
+        });
+    }
+    sig.connect(3, [](std::string const&, int) { return 100; });
+    sig.connect([](std::string const&, int) { return -1; }, Position::at_front);
+    auto const tracked = std::make_shared<int>(0);
+    sig.connect(Slot<int(std::string const&, int)>{
+        [](std::string const&, int) { return 7; }}.track(tracked));
+
+    auto const text = std::string(64, 'x');
+    auto result     = sig(text, 1);
+
+    auto const before = allocation_count.load();
+    for (auto i = 0; i < 100; ++i)
+        result = sig(text, 1);
+    CHECK(allocation_count.load() == before);
+
+    REQUIRE(bool(result));
+    CHECK(*result == 7);
+    CHECK(total == 101 * 10);
+
+    Signal<void()> void_sig;
+    void_sig.connect([] {});
+    void_sig();
+    auto const void_before = allocation_count.load();
+    void_sig();
+    CHECK(allocation_count.load() == void_before);
+}
+
+TEST_CASE("Signal with Inplace_function Slot_function does not allocate",
+          "[signal]")
+{
+    using Function = Inplace_function<int(int)>;
+    Signal<int(int), Optional_last_value<int>, int, std::less<int>, Function>
+        sig;
+
+    auto p = std::make_unique<int>(10);
+    sig.connect([p = std::move(p)](int x) { return *p + x; });
+    sig.connect(1, [](int x) { return x * 2; }, Position::at_front);
+    sig.connect_extended(
+        [](Connection const& c, int x) { return c.connected() ? x : -1; },
+        Position::at_front);
+    sig(5);
+
+    auto const before = allocation_count.load();
+    auto const result = sig(6);
+    CHECK(allocation_count.load() == before);
+    REQUIRE(bool(result));
+    CHECK(*result == 16);
+}
+
+TEST_CASE("Signal with queued connection does not allocate to post",
+          "[signal]")
+{
+    using Payload = std::array<char, Dispatcher::argument_capacity>;
+    Dispatcher d;
+    Signal<void(Payload const&)> sig;
+    auto received = 0;
+    sig.connect([&received](Payload const& p) { received += p[0]; }, d);
+
+    auto payload = Payload{};
+    payload[0]   = 1;
+    sig(payload);
+    d.run_pending();
+
+    auto const before = allocation_count.load();
+    for (auto i = 0; i < 10; ++i)
+        sig(payload);
+    CHECK(allocation_count.load() == before);
+    CHECK(10 == d.run_pending());
+    CHECK(11 == received);
+}
@@ -0,0 +1,193 @@
+#include <array>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <signals/combiners.hpp>
+#include <signals/shared_connection_block.hpp>
+#include <signals/signal.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Buffer_collector;
+using sig::First_non_empty;
+using sig::Optional_first_value;
+using sig::Optional_max;
+using sig::Optional_min;
+using sig::Optional_sum;
+using sig::Signal;
+using sig::Until_false;
+using sig::Until_true;
+using sig::Vector_collector;
+
+TEST_CASE("Optional_first_value calls only the first Slot", "[combiners]")
+{
+    auto calls = std::vector<int>{};
+    auto s     = Signal<int(int), Optional_first_value<int>>{};
+    CHECK_FALSE(s(1).has_value());
+
+    s.connect([&calls](int x) { calls.push_back(1); return x + 1; });
+    s.connect([&calls](int x) { calls.push_back(2); return x + 2; });
+    CHECK(s(1) == 2);
+    CHECK(calls == std::vector<int>{1});
+}
+
+TEST_CASE("Optional_first_value passes over blocked Slots", "[combiners]")
+{
+    auto s       = Signal<int(), Optional_first_value<int>>{};
+    auto const c = s.connect([] { return 1; });
+    s.connect([] { return 2; });
+    auto const block = sig::Shared_connection_block{c};
+    CHECK(s() == 2);
+}
+
+TEST_CASE("First_non_empty stops at the first result", "[combiners]")
+{
+    using Lookup = std::optional<std::string>;
+    auto calls   = 0;
+    auto s       = Signal<Lookup(int), First_non_empty<Lookup>>{};
+    CHECK_FALSE(s(0).has_value());
+
+    s.connect([&calls](int) -> Lookup { ++calls; return std::nullopt; });
+    s.connect([&calls](int key) -> Lookup {
+        ++calls;
+        if (key == 1)
+            return "one";
+        return std::nullopt;
+    });
+    s.connect([&calls](int) -> Lookup { ++calls; return "fallback"; });
+
+    CHECK(s(1) == "one");
+    CHECK(calls == 2);
+
+    calls = 0;
+    CHECK(s(2) == "fallback");
+    CHECK(calls == 3);
+}
+
+TEST_CASE("First_non_empty with pointers", "[combiners]")
+{
+    using Pointer    = std::shared_ptr<int>;
+    auto const value = std::make_shared<int>(5);
+    auto s           = Signal<Pointer(), First_non_empty<Pointer>>{};
+    s.connect([] { return Pointer{}; });
+    s.connect([&value] { return value; });
+    CHECK(s() == value);
+}
+
+TEST_CASE("Until_false stops at a veto", "[combiners]")
+{
+    auto calls = std::vector<int>{};
+    auto s     = Signal<bool(int), Until_false>{};
+    CHECK(s(0));
+
+    s.connect([&calls](int) { calls.push_back(1); return true; });
+    s.connect([&calls](int x) { calls.push_back(2); return x < 10; });
+    s.connect([&calls](int) { calls.push_back(3); return true; });
+
+    CHECK(s(5));
+    CHECK(calls == std::vector<int>{1, 2, 3});
+
+    calls.clear();
+    CHECK_FALSE(s(50));
+    CHECK(calls == std::vector<int>{1, 2});
+}
+
+TEST_CASE("Until_true stops at the first handler", "[combiners]")
+{
+    auto calls = std::vector<int>{};
+    auto s     = Signal<bool(int), Until_true>{};
+    CHECK_FALSE(s(0));
+
+    s.connect([&calls](int x) { calls.push_back(1); return x == 1; });
+    s.connect([&calls](int x) { calls.push_back(2); return x == 2; });
+    s.connect([&calls](int) { calls.push_back(3); return false; });
+
+    CHECK(s(1));
+    CHECK(calls == std::vector<int>{1});
+
+    calls.clear();
+    CHECK_FALSE(s(4));
+    CHECK(calls == std::vector<int>{1, 2, 3});
+}
+
+TEST_CASE("Optional_min and Optional_max", "[combiners]")
+{
+    auto values = std::vector<int>{4, 1, 9, 1, 7};
+
+    auto const min = Optional_min<int>{};
+    CHECK(min(std::begin(values), std::end(values)) == 1);
+    CHECK_FALSE(min(std::end(values), std::end(values)).has_value());
+
+    auto const max = Optional_max<int>{};
+    CHECK(max(std::begin(values), std::end(values)) == 9);
+    CHECK_FALSE(max(std::end(values), std::end(values)).has_value());
+
+    auto const reversed = Optional_min<int, std::greater<int>>{};
+    CHECK(reversed(std::begin(values), std::end(values)) == 9);
+
+    auto s = Signal<int(int), Optional_max<int>>{};
+    s.connect([](int x) { return x * 2; });
+    s.connect([](int x) { return x * 3; });
+    s.connect([](int x) { return x; });
+    CHECK(s(2) == 6);
+    CHECK(s(-2) == -2);
+}
+
+TEST_CASE("Optional_sum", "[combiners]")
+{
+    auto s = Signal<int(int), Optional_sum<int>>{};
+    CHECK_FALSE(s(1).has_value());
+    s.connect([](int x) { return x; });
+    s.connect([](int x) { return x * 10; });
+    CHECK(s(2) == 22);
+
+    auto words     = std::vector<std::string>{"a", "b", "c"};
+    auto const sum = Optional_sum<std::string>{};
+    CHECK(sum(std::begin(words), std::end(words)) == "abc");
+}
+
+TEST_CASE("Vector_collector collects up to its maximum", "[combiners]")
+{
+    auto calls = 0;
+    auto s     = Signal<int(int), Vector_collector<int>>{};
+    CHECK(s(1).empty());
+
+    for (auto i = 0; i < 4; ++i)
+        s.connect([&calls, i](int x) { ++calls; return x + i; });
+    CHECK(s(10) == std::vector<int>{10, 11, 12, 13});
+    CHECK(calls == 4);
+
+    calls = 0;
+    s.set_combiner(Vector_collector<int>{2});
+    CHECK(s(10) == std::vector<int>{10, 11});
+    CHECK(calls == 2);
+
+    s.set_combiner(Vector_collector<int>{0});
+    CHECK(s(10).empty());
+    CHECK(calls == 2);
+}
+
+TEST_CASE("Buffer_collector fills the caller's buffer", "[combiners]")
+{
+    auto calls  = 0;
+    auto buffer = std::array<int, 3>{};
+    auto s      = Signal<int(int), Buffer_collector<int>>{};
+    s.connect([&calls](int x) { ++calls; return x; });
+    CHECK(s(1) == 0);
+    CHECK(calls == 0);
+
+    s.set_combiner(Buffer_collector<int>{buffer.data(), buffer.size()});
+    CHECK(s(1) == 1);
+    CHECK(buffer[0] == 1);
+
+    for (auto i = 2; i < 6; ++i)
+        s.connect([&calls, i](int x) { ++calls; return x * i; });
+    calls = 0;
+    CHECK(s(3) == 3);
+    CHECK(buffer == std::array<int, 3>{3, 6, 9});
+    CHECK(calls == 3);
+}
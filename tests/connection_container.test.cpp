@@ -0,0 +1,156 @@
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include <signals/detail/connection_container.hpp>
+#include <signals/position.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Position;
+
+using Container = sig::Connection_container<int, int, std::less<int>>;
+
+namespace {
+
+auto contents(Container const& c) -> std::vector<int>
+{
+    return {std::begin(c), std::end(c)};
+}
+
+}  // namespace
+
+TEST_CASE("Connection_container call order", "[connection_container]")
+{
+    auto c = Container{};
+    CHECK(c.empty());
+
+    c.insert(1, Position::at_back);
+    c.insert(2, Position::at_front);
+    c.insert(5, 50, Position::at_back);
+    c.insert(3, 30, Position::at_back);
+    c.insert(3, 31, Position::at_back);
+    c.insert(3, 29, Position::at_front);
+    c.insert(3, Position::at_back);
+    c.insert(4, Position::at_front);
+    c.insert(4, 40, Position::at_front);
+
+    CHECK(contents(c) == std::vector<int>{4, 2, 29, 30, 31, 40, 50, 1, 3});
+    CHECK(c.size() == 9);
+
+    auto const [first, last] = c.group_range(3);
+    CHECK(std::vector<int>(first, last) == std::vector<int>{29, 30, 31});
+
+    auto const [none_first, none_last] = c.group_range(7);
+    CHECK(none_first == none_last);
+}
+
+TEST_CASE("Connection_container at_front growth", "[connection_container]")
+{
+    auto c = Container{};
+    c.insert(0, 100, Position::at_back);
+    auto expected = std::vector<int>{};
+    for (auto i = 0; i < 100; ++i) {
+        c.insert(i, Position::at_front);
+        expected.insert(std::begin(expected), i);
+    }
+    expected.push_back(100);
+    CHECK(contents(c) == expected);
+}
+
+TEST_CASE("Connection_container::insert_range()", "[connection_container]")
+{
+    auto c = Container{};
+    c.insert(1, Position::at_front);
+    c.insert(2, 20, Position::at_back);
+
+    auto const front = std::vector<int>{3, 4, 5, 6, 7};
+    c.insert_range(std::begin(front), std::end(front), Position::at_front);
+    auto const back = std::vector<int>{8, 9};
+    c.insert_range(std::begin(back), std::end(back), Position::at_back);
+    auto const group = std::vector<int>{21, 22};
+    c.insert_range(2, std::begin(group), std::end(group), Position::at_back);
+    auto const first = std::vector<int>{18, 19};
+    c.insert_range(2, std::begin(first), std::end(first), Position::at_front);
+    auto const other = std::vector<int>{10, 11};
+    c.insert_range(1, std::begin(other), std::end(other), Position::at_back);
+    c.insert_range(5, std::end(other), std::end(other), Position::at_back);
+
+    CHECK(contents(c) == std::vector<int>{3, 4, 5, 6, 7, 1, 10, 11, 18, 19, 20,
+                                          21, 22, 8, 9});
+    auto const [group_first, group_last] = c.group_range(2);
+    CHECK(std::vector<int>(group_first, group_last) ==
+          std::vector<int>{18, 19, 20, 21, 22});
+    CHECK(c.group_range(5).first == c.group_range(5).second);
+
+    // Headroom left by a block insert is still used by single inserts.
+    c.insert(0, Position::at_front);
+    CHECK(contents(c).front() == 0);
+    CHECK(c.front_size() == 7);
+}
+
+TEST_CASE("Connection_container::erase_group()", "[connection_container]")
+{
+    auto c = Container{};
+    c.insert(0, Position::at_front);
+    c.insert(1, 10, Position::at_back);
+    c.insert(2, 20, Position::at_back);
+    c.insert(2, 21, Position::at_back);
+    c.insert(3, 30, Position::at_back);
+    c.insert(99, Position::at_back);
+
+    c.erase_group(2);
+    CHECK(contents(c) == std::vector<int>{0, 10, 30, 99});
+    c.erase_group(7);
+    CHECK(contents(c) == std::vector<int>{0, 10, 30, 99});
+
+    c.insert(3, 31, Position::at_back);
+    c.insert(2, 22, Position::at_back);
+    CHECK(contents(c) == std::vector<int>{0, 10, 22, 30, 31, 99});
+}
+
+TEST_CASE("Connection_container::remove_if()", "[connection_container]")
+{
+    auto c = Container{};
+    c.insert(1, Position::at_front);
+    c.insert(2, Position::at_front);
+    c.insert(1, 10, Position::at_back);
+    c.insert(2, 21, Position::at_back);
+    c.insert(2, 20, Position::at_front);
+    c.insert(3, 31, Position::at_back);
+    c.insert(5, Position::at_back);
+    c.insert(6, Position::at_back);
+
+    c.remove_if([](int x) { return x % 2 == 1; });
+    CHECK(contents(c) == std::vector<int>{2, 10, 20, 6});
+
+    // Group 3 was emptied, so it must be recreated in the right place.
+    c.insert(3, 30, Position::at_back);
+    c.insert(2, 22, Position::at_back);
+    c.insert(8, Position::at_front);
+    CHECK(contents(c) == std::vector<int>{8, 2, 10, 20, 22, 30, 6});
+
+    c.clear();
+    CHECK(c.empty());
+    c.insert(4, 40, Position::at_back);
+    CHECK(contents(c) == std::vector<int>{40});
+}
+
+TEST_CASE("Connection_container move", "[connection_container]")
+{
+    auto c = Container{};
+    c.insert(1, Position::at_front);
+    c.insert(2, Position::at_front);
+    c.insert(1, 10, Position::at_back);
+
+    auto moved = std::move(c);
+    CHECK(contents(moved) == std::vector<int>{2, 1, 10});
+    CHECK(c.empty());
+    c.insert(3, Position::at_front);
+    c.insert(1, 11, Position::at_back);
+    CHECK(contents(c) == std::vector<int>{3, 11});
+
+    moved = std::move(c);
+    CHECK(contents(moved) == std::vector<int>{3, 11});
+    CHECK(c.empty());
+}
@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include <signals/connection.hpp>
+#include <signals/connection_handle.hpp>
+#include <signals/shared_connection_block.hpp>
+#include <signals/signal.hpp>
+#include <signals/threading.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Connection;
+using sig::Connection_handle;
+using sig::Null_mutex;
+using sig::Shared_connection_block;
+using sig::Signal;
+
+TEST_CASE("Connection_handle()", "[connection_handle]")
+{
+    CHECK(std::is_trivially_copyable_v<Connection_handle>);
+    CHECK(sizeof(Connection_handle) == sizeof(void*) + 8);
+
+    auto const h = Connection_handle{};
+    CHECK_FALSE(h.connected());
+    CHECK_FALSE(h.blocked());
+    h.disconnect();
+    CHECK(h == Connection{}.handle());
+}
+
+TEST_CASE("Connection_handle::disconnect()", "[connection_handle]")
+{
+    Signal<void(int&)> sig;
+    auto const c = sig.connect([](int& i) { ++i; });
+    auto const h = c.handle();
+    CHECK(h.connected());
+    CHECK(h == c.handle());
+
+    auto count = 0;
+    sig(count);
+    CHECK(count == 1);
+
+    h.disconnect();
+    CHECK_FALSE(h.connected());
+    CHECK_FALSE(c.connected());
+    sig(count);
+    CHECK(count == 1);
+}
+
+TEST_CASE("Connection_handle::blocked()", "[connection_handle]")
+{
+    Signal<void()> sig;
+    auto const c = sig.connect([] {});
+    auto const h = c.handle();
+    CHECK_FALSE(h.blocked());
+    {
+        auto const block = Shared_connection_block{c};
+        CHECK(h.blocked());
+        CHECK(h.connected());
+    }
+    CHECK_FALSE(h.blocked());
+}
+
+TEST_CASE("Connection_handle outlives its connection", "[connection_handle]")
+{
+    auto h = Connection_handle{};
+    {
+        Signal<void()> sig;
+        h = sig.connect([] {}).handle();
+        CHECK(h.connected());
+    }
+    CHECK_FALSE(h.connected());
+    h.disconnect();
+
+    // The entry is reused with a new generation, the old handle stays stale.
+    Signal<void()> sig;
+    auto const c     = sig.connect([] {});
+    auto const fresh = c.handle();
+    CHECK(fresh != h);
+    CHECK_FALSE(h.connected());
+    h.disconnect();
+    CHECK(fresh.connected());
+    CHECK(c.connected());
+}
+
+TEST_CASE("Connection_handle hashing and ordering", "[connection_handle]")
+{
+    Signal<void()> sig;
+    auto handles = std::unordered_set<Connection_handle>{};
+    auto first   = Connection_handle{};
+    for (auto i = 0; i < 100; ++i) {
+        auto const h = sig.connect([] {}).handle();
+        handles.insert(h);
+        if (i == 0)
+            first = h;
+        else
+            CHECK((first < h || h < first));
+    }
+    CHECK(handles.size() == 100);
+    CHECK(handles.count(first) == 1);
+    CHECK(std::hash<Connection_handle>{}(first) ==
+          std::hash<Connection_handle>{}(Connection_handle{first}));
+}
+
+TEST_CASE("Connection_handle with a Single_threaded Signal",
+          "[connection_handle]")
+{
+    Signal<int(), sig::Optional_last_value<int>, int, std::less<int>,
+           std::function<int()>, Null_mutex>
+        sig;
+    auto const h = sig.connect([] { return 1; }).handle();
+    sig.connect([] { return 2; }, sig::Position::at_front);
+    CHECK(*sig() == 1);
+    h.disconnect();
+    CHECK(*sig() == 2);
+}
+
+TEST_CASE("Connection_handle::disconnect() concurrent with emission",
+          "[connection_handle]")
+{
+    Signal<void()> sig;
+    auto handles = std::vector<Connection_handle>{};
+    for (auto i = 0; i < 100; ++i)
+        handles.push_back(sig.connect([] {}).handle());
+
+    auto emitter = std::thread{[&sig] {
+        for (auto i = 0; i < 1'000; ++i)
+            sig();
+    }};
+    for (auto const& h : handles)
+        h.disconnect();
+    emitter.join();
+    CHECK(sig.empty());
+}
+
+TEST_CASE("Connection_handle of Single_threaded and Multi_threaded Signals",
+          "[connection_handle]")
+{
+    Signal<void(), sig::Optional_last_value<void>, int, std::less<int>,
+           std::function<void()>, Null_mutex>
+        single;
+    Signal<void()> multi;
+    auto const s = single.connect([] {}).handle();
+    auto const m = multi.connect([] {}).handle();
+    CHECK(s != m);
+    CHECK(s.connected());
+    CHECK(m.connected());
+    s.disconnect();
+    CHECK_FALSE(s.connected());
+    CHECK(m.connected());
+}
+
+TEST_CASE("Connection_handle entries reused across threads",
+          "[connection_handle]")
+{
+    auto stale_connected = std::atomic<int>{0};
+    auto threads         = std::vector<std::thread>{};
+    for (auto t = 0; t < 4; ++t) {
+        threads.emplace_back([&stale_connected] {
+            Signal<void()> sig;
+            auto handles = std::vector<Connection_handle>{};
+            for (auto round = 0; round < 50; ++round) {
+                auto connections = std::vector<Connection>{};
+                for (auto i = 0; i < 100; ++i)
+                    connections.push_back(sig.connect([] {}));
+                for (auto const& c : connections)
+                    handles.push_back(c.handle());
+                sig.disconnect_all_slots();
+            }
+            for (auto const& h : handles) {
+                if (h.connected())
+                    ++stale_connected;
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    CHECK(stale_connected == 0);
+
+    // More entries than fit in the first chunks.
+    Signal<void()> sig;
+    auto connections = std::vector<Connection>{};
+    for (auto i = 0; i < 5'000; ++i)
+        connections.push_back(sig.connect([] {}));
+    auto const all_connected =
+        std::all_of(std::begin(connections), std::end(connections),
+                    [](auto const& c) { return c.handle().connected(); });
+    CHECK(all_connected);
+}
+
+TEST_CASE("Connection_handle tables are per Signal", "[connection_handle]")
+{
+    Signal<void()> first;
+    Signal<void()> second;
+    auto const a = first.connect([] {}).handle();
+    auto const b = second.connect([] {}).handle();
+    CHECK(a != b);
+    a.disconnect();
+    CHECK_FALSE(a.connected());
+    CHECK(b.connected());
+
+    // Copies share the table, their connections get entries of their own.
+    auto copy    = first;
+    auto const c = copy.connect([] {}).handle();
+    CHECK(c.index() != a.index());
+}
+
+TEST_CASE("Connection_handle used while its connection is destroyed",
+          "[connection_handle]")
+{
+    auto signals = std::vector<Signal<void()>>(50);
+    auto handles = std::vector<Connection_handle>{};
+    for (auto& sig : signals) {
+        for (auto i = 0; i < 64; ++i)
+            handles.push_back(sig.connect([] {}).handle());
+    }
+
+    auto done = std::atomic<bool>{false};
+    auto user = std::thread{[&] {
+        while (!done) {
+            for (auto const& h : handles) {
+                if (h.connected() && !h.blocked())
+                    h.disconnect();
+            }
+        }
+    }};
+    while (!signals.empty())
+        signals.pop_back();
+    done = true;
+    user.join();
+    CHECK(std::none_of(std::begin(handles), std::end(handles),
+                       [](auto const& h) { return h.connected(); }));
+}
@@ -47,6 +47,28 @@ TEST_CASE("Connection_impl::blocked()", "[connection_impl]")
     CHECK_FALSE(impl2.blocked());
 }
 
+TEST_CASE("Connection_impl block count and connected flag", "[connection_impl]")
+{
+    Slot<void(int)> s = [](int) { return; };
+    Connection_impl<void(int)> impl(s);
+
+    impl.add_block();
+    impl.add_block();
+    CHECK(impl.blocked());
+    CHECK(impl.connected());
+
+    impl.remove_block();
+    CHECK(impl.blocked());
+
+    impl.disconnect();
+    CHECK_FALSE(impl.connected());
+    CHECK(impl.blocked());
+
+    impl.remove_block();
+    CHECK_FALSE(impl.blocked());
+    CHECK_FALSE(impl.connected());
+}
+
 TEST_CASE("Connection_impl::connected()", "[connection_impl]")
 {
     Slot<void(int)> s = [](int) { return; };
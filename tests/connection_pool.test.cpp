@@ -0,0 +1,130 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <signals/connection.hpp>
+#include <signals/connection_pool.hpp>
+#include <signals/signal.hpp>
+#include <signals/threading.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Connection;
+using sig::Connection_pool;
+using sig::Connection_pool_allocator;
+using sig::Null_mutex;
+using sig::Signal;
+
+TEST_CASE("Connection_pool::allocate()", "[connection_pool]")
+{
+    constexpr auto block = Connection_pool<>::granularity * 2;
+    Connection_pool<> pool{4};
+    CHECK(0 == pool.in_use());
+
+    // Blocks of one slab are handed out in address order.
+    auto blocks = std::vector<std::byte*>{};
+    for (auto i = 0; i < 4; ++i)
+        blocks.push_back(static_cast<std::byte*>(pool.allocate(block)));
+    CHECK(4 == pool.in_use());
+    for (auto i = 1; i < 4; ++i)
+        CHECK(blocks[i] == blocks[i - 1] + block);
+    for (auto* p : blocks) {
+        CHECK(0 == reinterpret_cast<std::uintptr_t>(p) %
+                       alignof(std::max_align_t));
+    }
+
+    // Freed blocks are recycled, most recent first.
+    pool.deallocate(blocks[2], block);
+    pool.deallocate(blocks[1], block);
+    CHECK(2 == pool.in_use());
+    CHECK(blocks[1] == pool.allocate(block));
+    CHECK(blocks[2] == pool.allocate(block - 1));
+
+    // Another slab once the first is used up, sizes have their own lists.
+    auto* const extra = pool.allocate(block);
+    CHECK(extra != nullptr);
+    auto* const small = pool.allocate(1);
+    CHECK(small != extra);
+    CHECK(6 == pool.in_use());
+
+    // Oversized blocks bypass the slabs.
+    auto* const large = pool.allocate(Connection_pool<>::max_block_size + 1);
+    CHECK(6 == pool.in_use());
+    pool.deallocate(large, Connection_pool<>::max_block_size + 1);
+
+    pool.deallocate(small, 1);
+    pool.deallocate(extra, block);
+    for (auto* p : blocks)
+        pool.deallocate(p, block);
+    CHECK(0 == pool.in_use());
+}
+
+TEST_CASE("Connection_pool_allocator", "[connection_pool]")
+{
+    auto const pool = std::make_shared<Connection_pool<Null_mutex>>();
+    auto const alloc = Connection_pool_allocator<int, Null_mutex>{pool};
+    auto const other = Connection_pool_allocator<double, Null_mutex>{alloc};
+    CHECK(alloc == other);
+    CHECK(alloc != Connection_pool_allocator<int, Null_mutex>{
+                       std::make_shared<Connection_pool<Null_mutex>>()});
+
+    auto shared = std::allocate_shared<int>(alloc, 5);
+    CHECK(5 == *shared);
+    CHECK(1 == pool->in_use());
+    shared.reset();
+    CHECK(0 == pool->in_use());
+}
+
+TEST_CASE("Signal allocates connections from its pool", "[connection_pool]")
+{
+    Signal<void(int)> sig;
+    auto const pool = sig.connection_pool();
+    CHECK(pool == sig.connection_pool());
+
+    auto c1 = sig.connect([](int) {});
+    auto c2 = sig.connect_extended([](Connection const&, int) {});
+    CHECK(2 == pool->in_use());
+
+    // Connection stays a weak reference, the block is only recycled once the
+    // last Connection to it is gone.
+    sig.disconnect_all_slots();
+    CHECK(!c1.connected());
+    CHECK(2 == pool->in_use());
+    c1 = Connection{};
+    c2 = Connection{};
+    CHECK(0 == pool->in_use());
+
+    // Connections keep the pool alive past the Signal.
+    auto c3 = Connection{};
+    auto weak_pool = std::weak_ptr<Connection_pool<std::mutex>>{};
+    {
+        Signal<void(int)> temp;
+        c3        = temp.connect([](int) {});
+        weak_pool = temp.connection_pool();
+    }
+    CHECK(!weak_pool.expired());
+    CHECK(!c3.connected());
+    c3 = Connection{};
+    CHECK(weak_pool.expired());
+}
+
+TEST_CASE("Signal::set_connection_pool()", "[connection_pool]")
+{
+    auto const shared = std::make_shared<Connection_pool<std::mutex>>();
+    Signal<void(int)> sig1;
+    Signal<void(int)> sig2;
+    sig1.set_connection_pool(shared);
+    sig2.set_connection_pool(shared);
+
+    sig1.connect([](int) {});
+    sig2.connect([](int) {});
+    CHECK(2 == shared->in_use());
+    CHECK(shared == sig1.connection_pool());
+
+    auto total = 0;
+    sig1.connect([&total](int i) { total += i; });
+    sig1(3);
+    CHECK(3 == total);
+}
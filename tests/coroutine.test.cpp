@@ -0,0 +1,252 @@
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <signals/signal.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Signal;
+
+namespace {
+
+// Coroutine that starts eagerly and is destroyed by its owner.
+class Task {
+   public:
+    struct promise_type {
+        auto get_return_object() -> Task
+        {
+            return Task{std::coroutine_handle<promise_type>::from_promise(
+                *this)};
+        }
+        auto initial_suspend() noexcept -> std::suspend_never { return {}; }
+        auto final_suspend() noexcept -> std::suspend_always { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    explicit Task(std::coroutine_handle<promise_type> h) : handle_{h} {}
+
+    Task(Task&& other) noexcept : handle_{std::exchange(other.handle_, {})} {}
+
+    ~Task()
+    {
+        if (handle_)
+            handle_.destroy();
+    }
+
+    auto done() const -> bool { return handle_.done(); }
+
+   private:
+    std::coroutine_handle<promise_type> handle_;
+};
+
+}  // namespace
+
+TEST_CASE("Signal::next()", "[coroutine]")
+{
+    Signal<void(int, std::string const&)> sig;
+    auto received = std::vector<std::tuple<int, std::string>>{};
+    auto const wait_twice =
+        [&](Signal<void(int, std::string const&)>& s) -> Task {
+        received.push_back(co_await s.next());
+        received.push_back(co_await s.next());
+    };
+
+    auto task = wait_twice(sig);
+    CHECK(!task.done());
+    CHECK(received.empty());
+
+    sig(1, "one");
+    CHECK(!task.done());
+    sig(2, "two");
+    CHECK(task.done());
+    sig(3, "three");
+    CHECK(received ==
+          std::vector<std::tuple<int, std::string>>{{1, "one"}, {2, "two"}});
+
+    // Resumed after the Slots of the same emission.
+    auto order = std::vector<int>{};
+    sig.connect([&order](int, std::string const&) { order.push_back(1); });
+    auto const record = [&]() -> Task {
+        co_await sig.next();
+        order.push_back(2);
+    };
+    auto task2 = record();
+    sig(4, "four");
+    CHECK(order == std::vector<int>{1, 2});
+
+    // Destroying a suspended coroutine unregisters it.
+    {
+        auto abandoned = record();
+    }
+    sig(5, "five");
+    CHECK(order == std::vector<int>{1, 2, 1});
+}
+
+TEST_CASE("Signal::next() from another thread", "[coroutine]")
+{
+    Signal<void(int)> sig;
+    auto resumed_on = std::thread::id{};
+    auto value      = 0;
+    auto const wait = [&]() -> Task {
+        value      = std::get<0>(co_await sig.next());
+        resumed_on = std::this_thread::get_id();
+    };
+    auto task             = wait();
+    auto emitter          = std::thread{[&sig] { sig(42); }};
+    auto const emitter_id = emitter.get_id();
+    emitter.join();
+    CHECK(task.done());
+    CHECK(42 == value);
+    CHECK(emitter_id == resumed_on);
+}
+
+TEST_CASE("Signal::emissions()", "[coroutine]")
+{
+    Signal<void(int)> sig;
+    auto received = std::vector<int>{};
+    auto const consume = [&](int count) -> Task {
+        auto stream = sig.emissions();
+        for (auto i = 0; i < count; ++i)
+            received.push_back(std::get<0>(co_await stream.next()));
+    };
+
+    auto task = consume(3);
+    sig(1);
+    CHECK(received == std::vector<int>{1});
+    sig(2);
+    sig(3);
+    CHECK(task.done());
+    CHECK(received == std::vector<int>{1, 2, 3});
+
+    // Emissions between two awaits are buffered, not lost.
+    auto stream      = sig.emissions();
+    auto const drain = [&]() -> Task {
+        received.push_back(std::get<0>(co_await stream.next()));
+        received.push_back(std::get<0>(co_await stream.next()));
+    };
+    sig(4);
+    sig(5);
+    sig(6);
+    auto task2 = drain();
+    CHECK(task2.done());
+    CHECK(received == std::vector<int>{1, 2, 3, 4, 5});
+}
+
+TEST_CASE("Signal::next() outlived by its coroutine", "[coroutine]")
+{
+    auto resumed    = false;
+    auto task       = std::optional<Task>{};
+    auto const wait = [&resumed](Signal<void()>& s) -> Task {
+        co_await s.next();
+        resumed = true;
+    };
+    {
+        Signal<void()> sig;
+        task.emplace(wait(sig));
+    }
+    CHECK(!resumed);
+    CHECK(!task->done());
+    task.reset();
+}
+
+TEST_CASE("Signal::next() on a moved Signal", "[coroutine]")
+{
+    auto received   = std::vector<int>{};
+    auto const wait = [&received](Signal<void(int)>& s) -> Task {
+        received.push_back(std::get<0>(co_await s.next()));
+    };
+
+    // Waiters follow the Signal they were waiting on.
+    Signal<void(int)> from;
+    auto task  = wait(from);
+    auto moved = Signal<void(int)>{std::move(from)};
+    from(1);
+    CHECK(!task.done());
+    moved(2);
+    CHECK(task.done());
+    CHECK(received == std::vector<int>{2});
+
+    // Assignment keeps the waiters of the target and appends those moved in.
+    auto stream        = moved.emissions();
+    auto const consume = [&]() -> Task {
+        received.push_back(std::get<0>(co_await stream.next()));
+    };
+    Signal<void(int)> target;
+    auto task2 = wait(target);
+    target     = std::move(moved);
+    moved(3);
+    CHECK(!task2.done());
+    target(4);
+    CHECK(task2.done());
+    auto task3 = consume();
+    CHECK(task3.done());
+    CHECK(received == std::vector<int>{2, 4, 4});
+
+    // Copies start without waiters.
+    auto task4 = wait(target);
+    auto copy  = target;
+    copy(5);
+    CHECK(!task4.done());
+    target(6);
+    CHECK(task4.done());
+    CHECK(received == std::vector<int>{2, 4, 4, 6});
+}
+
+TEST_CASE("Signal::emit_batch() resumes awaiting coroutines", "[coroutine]")
+{
+    Signal<void(int)> sig;
+    auto received   = std::vector<int>{};
+    auto const wait = [&]() -> Task {
+        received.push_back(std::get<0>(co_await sig.next()));
+    };
+    auto const consume = [&](int count) -> Task {
+        auto stream = sig.emissions();
+        for (auto i = 0; i < count; ++i)
+            received.push_back(std::get<0>(co_await stream.next()));
+    };
+    auto const batch = std::vector<std::tuple<int>>{{1}, {2}};
+
+    auto task   = wait();
+    auto stream = consume(4);
+    sig.emit_batch(batch);
+    CHECK(task.done());
+    CHECK(received == std::vector<int>{1, 1, 2});
+
+    auto task2 = wait();
+    sig.emit_batch(batch, sig::Batch_order::slot_major);
+    CHECK(task2.done());
+    CHECK(stream.done());
+    CHECK(received == std::vector<int>{1, 1, 2, 1, 1, 2});
+}
+
+TEST_CASE("Signal::next() resumed coroutine emitting again", "[coroutine]")
+{
+    Signal<void(int)> sig;
+    auto received   = std::vector<int>{};
+    auto const echo = [&]() -> Task {
+        auto const [value] = co_await sig.next();
+        received.push_back(value);
+        sig(value + 10);
+    };
+    auto const consume = [&](int count) -> Task {
+        auto stream = sig.emissions();
+        for (auto i = 0; i < count; ++i)
+            received.push_back(std::get<0>(co_await stream.next()));
+    };
+
+    // The nested emission finds the stream already delivered to by the outer
+    // one, which still resumes it exactly once.
+    auto task   = echo();
+    auto stream = consume(2);
+    sig(1);
+    CHECK(task.done());
+    CHECK(stream.done());
+    CHECK(received == std::vector<int>{1, 1, 11});
+}
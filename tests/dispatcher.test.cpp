@@ -0,0 +1,134 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <signals/dispatcher.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Dispatcher;
+
+TEST_CASE("Dispatcher::Dispatcher()", "[dispatcher]")
+{
+    CHECK(1'024 == Dispatcher{}.capacity());
+    CHECK(2 == Dispatcher{0}.capacity());
+    CHECK(8 == Dispatcher{5}.capacity());
+
+    Dispatcher d;
+    CHECK(d.empty());
+    CHECK(0 == d.run_pending());
+}
+
+TEST_CASE("Dispatcher::run_pending()", "[dispatcher]")
+{
+    Dispatcher d{4};
+    auto order = std::vector<int>{};
+    for (auto i = 0; i < 4; ++i)
+        d.post([&order, i] { order.push_back(i); });
+    CHECK(!d.empty());
+
+    // Full, so try_post leaves the task with the caller.
+    auto task = Dispatcher::Task{[&order] { order.push_back(4); }};
+    CHECK(!d.try_post(task));
+    CHECK(bool(task));
+
+    CHECK(4 == d.run_pending());
+    CHECK(d.empty());
+    CHECK(order == std::vector<int>{0, 1, 2, 3});
+    CHECK(d.try_post(task));
+    CHECK(!task);
+
+    // Tasks posted while running wait for the next call.
+    d.post([&] {
+        order.push_back(5);
+        d.post([&order] { order.push_back(6); });
+    });
+    CHECK(2 == d.run_pending());
+    CHECK(1 == d.run_pending());
+    CHECK(order == std::vector<int>{0, 1, 2, 3, 4, 5, 6});
+
+    // Move-only tasks.
+    auto value = std::make_unique<int>(7);
+    auto got   = 0;
+    d.post([v = std::move(value), &got] { got = *v; });
+    d.run_pending();
+    CHECK(7 == got);
+}
+
+TEST_CASE("Dispatcher::post() from the draining thread", "[dispatcher]")
+{
+    Dispatcher d{2};
+    auto order = std::vector<int>{};
+
+    // The third post finds the ring full, and nothing else would drain it,
+    // so it overflows. Posts behind it keep their order.
+    d.post([&] {
+        for (auto i = 1; i <= 3; ++i)
+            d.post([&order, i] { order.push_back(i); });
+        order.push_back(0);
+    });
+    CHECK(1 == d.run_pending());
+    CHECK(order == std::vector<int>{0});
+    d.post([&order] { order.push_back(4); });
+    CHECK(4 == d.run_pending());
+    CHECK(d.empty());
+    CHECK(order == std::vector<int>{0, 1, 2, 3, 4});
+
+    // Other threads still wait for room.
+    d.post([] {});
+    d.post([] {});
+    auto posted   = std::atomic<bool>{false};
+    auto producer = std::thread{[&] {
+        d.post([&order] { order.push_back(5); });
+        posted = true;
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    CHECK(!posted);
+    CHECK(2 == d.run_pending());
+    producer.join();
+    CHECK(posted);
+    CHECK(1 == d.run_pending());
+    CHECK(order == std::vector<int>{0, 1, 2, 3, 4, 5});
+}
+
+TEST_CASE("Dispatcher with concurrent producers", "[dispatcher]")
+{
+    constexpr auto producers  = 4;
+    constexpr auto per_thread = 5'000;
+
+    Dispatcher d{64};
+    auto sum     = std::size_t{0};
+    auto threads = std::vector<std::thread>{};
+    for (auto p = 0; p < producers; ++p) {
+        threads.emplace_back([&d, &sum] {
+            for (auto i = 1; i <= per_thread; ++i)
+                d.post([&sum, i] { sum += i; });
+        });
+    }
+    auto run = std::size_t{0};
+    while (run < producers * per_thread) {
+        d.wait();
+        run += d.run_pending();
+    }
+    for (auto& t : threads)
+        t.join();
+    CHECK(d.empty());
+    CHECK(producers * (per_thread * (per_thread + 1) / 2) == sum);
+}
+
+TEST_CASE("Dispatcher::wait_for()", "[dispatcher]")
+{
+    Dispatcher d;
+    CHECK(!d.wait_for(std::chrono::milliseconds(1)));
+
+    auto producer = std::thread{[&d] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        d.post([] {});
+    }};
+    CHECK(d.wait_for(std::chrono::seconds(10)));
+    CHECK(1 == d.run_pending());
+    producer.join();
+}
@@ -0,0 +1,93 @@
+#include <array>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <signals/inplace_function.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Inplace_function;
+
+TEST_CASE("Inplace_function()", "[inplace_function]")
+{
+    Inplace_function<int(int)> f;
+    CHECK_FALSE(bool(f));
+    CHECK(f == nullptr);
+    CHECK_THROWS_AS(f(1), std::bad_function_call);
+
+    Inplace_function<int(int)> g = nullptr;
+    CHECK(g == nullptr);
+
+    int (*fn_ptr)(int) = nullptr;
+    Inplace_function<int(int)> h{fn_ptr};
+    CHECK(h == nullptr);
+}
+
+TEST_CASE("Inplace_function calls stored callables", "[inplace_function]")
+{
+    auto offset = 3;
+    Inplace_function<int(int)> f{[offset](int x) { return x + offset; }};
+    REQUIRE(f != nullptr);
+    CHECK(f(4) == 7);
+
+    struct Adder {
+        int value;
+        auto add(int x) const -> int { return value + x; }
+    };
+    Inplace_function<int(Adder const&, int)> member = &Adder::add;
+    CHECK(member(Adder{2}, 5) == 7);
+
+    Inplace_function<void(int&)> void_f{[](int& x) { return ++x; }};
+    auto i = 1;
+    void_f(i);
+    CHECK(i == 2);
+}
+
+TEST_CASE("Inplace_function stores move-only callables", "[inplace_function]")
+{
+    auto p = std::make_unique<int>(42);
+    Inplace_function<int()> f{[p = std::move(p)] { return *p; }};
+    CHECK(f() == 42);
+    CHECK_FALSE(std::is_copy_constructible_v<Inplace_function<int()>>);
+
+    auto g = std::move(f);
+    CHECK(f == nullptr);
+    CHECK(g() == 42);
+
+    Inplace_function<int()> h;
+    h = std::move(g);
+    CHECK(g == nullptr);
+    CHECK(h() == 42);
+
+    h = [] { return 3; };
+    CHECK(h() == 3);
+    h = nullptr;
+    CHECK(h == nullptr);
+}
+
+TEST_CASE("Inplace_function falls back to the heap", "[inplace_function]")
+{
+    auto const token = std::make_shared<int>(0);
+    auto big         = std::array<long, 32>{};
+    big[31]          = 9;
+    {
+        Inplace_function<long(), 16> f{[big, token] { return big[31]; }};
+        CHECK(token.use_count() == 2);
+        auto g = std::move(f);
+        CHECK(token.use_count() == 2);
+        CHECK(g() == 9);
+    }
+    CHECK(token.use_count() == 1);
+}
+
+TEST_CASE("Inplace_function with noexcept signature", "[inplace_function]")
+{
+    Inplace_function<int(int) noexcept> f{[](int x) noexcept { return x * 2; }};
+    CHECK(noexcept(f(1)));
+    CHECK(f(4) == 8);
+    CHECK_FALSE(noexcept(std::declval<Inplace_function<int(int)>&>()(1)));
+    CHECK_FALSE(std::is_constructible_v<Inplace_function<int(int) noexcept>,
+                                        int (*)(int)>);
+}
@@ -1,7 +1,12 @@
+#include <any>
 #include <iterator>
+#include <memory>
 #include <vector>
 
+#include <signals/expired_slot.hpp>
 #include <signals/optional_last_value.hpp>
+#include <signals/signal.hpp>
+#include <signals/slot.hpp>
 
 #include <catch2/catch.hpp>
 
@@ -23,3 +28,87 @@ TEST_CASE("Return std::nullopt for empty range", "[optional_last_value]")
     Result_t result = olv(std::begin(vec), std::end(vec));
     CHECK_FALSE(bool(result));
 }
+
+namespace {
+
+// Counts constructions, has no default constructor and no assignment.
+struct Counted {
+    static inline int constructed = 0;
+    static inline int copied      = 0;
+    static inline int moved       = 0;
+
+    explicit Counted(int v) : value{v} { ++constructed; }
+    Counted(Counted const& x) : value{x.value} { ++copied; }
+    Counted(Counted&& x) noexcept : value{x.value} { ++moved; }
+    auto operator=(Counted const&) -> Counted& = delete;
+
+    int value;
+};
+
+}  // namespace
+
+TEST_CASE("Construct values in place", "[optional_last_value]")
+{
+    auto s = sig::Signal<Counted(int)>{};
+    s.connect([](int x) { return Counted{x}; });
+    s.connect([](int x) { return Counted{x * 2}; });
+    s.connect([](int x) { return Counted{x * 3}; });
+
+    Counted::constructed = 0;
+    Counted::copied      = 0;
+    Counted::moved       = 0;
+    auto const result    = s(5);
+    REQUIRE(result.has_value());
+    CHECK(result->value == 15);
+    CHECK(Counted::constructed == 3);
+    CHECK(Counted::copied == 0);
+    CHECK(Counted::moved == 1);
+
+    // Results of earlier Slots are never moved, whatever their number.
+    for (auto i = 0; i < 10; ++i)
+        s.connect([](int x) { return Counted{x}; });
+    Counted::moved = 0;
+    CHECK(s(1)->value == 1);
+    CHECK(Counted::copied == 0);
+    CHECK(Counted::moved == 1);
+}
+
+TEST_CASE("Value with catch all constructor", "[optional_last_value]")
+{
+    auto vec          = std::vector<std::any>{1, 2, 3};
+    auto olv          = sig::Optional_last_value<std::any>{};
+    auto const result = olv(std::begin(vec), std::end(vec));
+    REQUIRE(result.has_value());
+    CHECK(std::any_cast<int>(*result) == 3);
+}
+
+TEST_CASE("Refer to the last value", "[optional_last_value]")
+{
+    auto a = 1;
+    auto b = 2;
+    auto s = sig::Signal<int&()>{};
+    CHECK_FALSE(s().has_value());
+
+    s.connect([&a]() -> int& { return a; });
+    s.connect([&b]() -> int& { return b; });
+    auto const result = s();
+    REQUIRE(result.has_value());
+    CHECK(&result->get() == &b);
+    result->get() = 3;
+    CHECK(b == 3);
+
+    auto vec = std::vector<int>{1, 2, 3};
+    auto olv = sig::Optional_last_value<int&>{};
+    CHECK(&olv(std::begin(vec), std::end(vec))->get() == &vec.back());
+}
+
+TEST_CASE("Expired Slot returning a reference throws", "[optional_last_value]")
+{
+    auto a       = 1;
+    auto tracked = std::make_shared<int>(0);
+    auto slot    = sig::Slot<int&()>{[&a]() -> int& { return a; }};
+    slot.track(tracked);
+    CHECK(&slot() == &a);
+    tracked.reset();
+    CHECK_THROWS_AS(slot(), sig::Expired_slot);
+}
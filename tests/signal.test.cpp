@@ -1,23 +1,48 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <functional>
+#include <future>
 #include <memory>
 #include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 
+#include <signals/batch_order.hpp>
+#include <signals/combiners.hpp>
 #include <signals/connection.hpp>
+#include <signals/dispatcher.hpp>
 #include <signals/expired_slot.hpp>
+#include <signals/inplace_function.hpp>
+#include <signals/move_only_arguments.hpp>
 #include <signals/optional_last_value.hpp>
 #include <signals/position.hpp>
+#include <signals/shared_connection_block.hpp>
 #include <signals/signal.hpp>
 #include <signals/slot.hpp>
+#include <signals/thread_pool.hpp>
 
 #include <catch2/catch.hpp>
 
+using sig::Batch_order;
 using sig::Connection;
+using sig::Dispatcher;
 using sig::Expired_slot;
+using sig::Inplace_function;
+using sig::Move_only_arguments;
+using sig::Optional_first_value;
 using sig::Optional_last_value;
 using sig::Position;
+using sig::Shared_connection_block;
 using sig::Signal;
 using sig::Slot;
+using sig::Thread_pool;
 
 TEST_CASE("Signal::arity", "[signal]")
 {
@@ -103,6 +128,8 @@ TEST_CASE("Signal in Slot connected to Signal", "[signal]")
 
 TEST_CASE("Signal(Signal&&)", "[signal]")
 {
+    CHECK(std::is_nothrow_move_constructible_v<Signal<char(int, double)>>);
+
     Signal<char(int, double)> sig;
     Slot<char(int, double)> slot_1 = [](int, double) { return 'h'; };
     auto to_track1                 = std::make_shared<int>(7);
@@ -355,6 +382,38 @@ TEST_CASE("Signal::connect() with tracked object", "[signal]")
     // EXPECT_THROW(sig('l', 'k'), Expired_slot);  // slot has expired
 }
 
+TEST_CASE("Signal::operator() pins tracked objects for the call", "[signal]")
+{
+    Signal<int()> sig;
+    auto first  = std::make_shared<int>(1);
+    auto second = std::make_shared<int>(2);
+
+    // An earlier Slot releasing a tracked object expires the later Slot.
+    sig.connect([&second] {
+        second.reset();
+        return 1;
+    });
+    auto slot = Slot<int()>{[] { return 2; }};
+    slot.track(second);
+    sig.connect(slot);
+
+    // A Slot releasing its own tracked object keeps it until it returns.
+    auto observed = std::weak_ptr<int>{first};
+    auto alive    = false;
+    auto last     = Slot<int()>{[&] {
+        first.reset();
+        alive = !observed.expired();
+        return 3;
+    }};
+    last.track(first);
+    sig.connect(last);
+
+    CHECK(*sig() == 3);
+    CHECK(alive);
+    CHECK(observed.expired());
+    CHECK(*sig() == 1);
+}
+
 TEST_CASE("Signal::connect with extended position", "[signal]")
 {
     Signal<char(int, int)> sig;
@@ -642,6 +701,74 @@ TEST_CASE("Signal::disconnted by group", "[signal]")
     CHECK('a' == *result3);
 }
 
+TEST_CASE("Signal::connect_range()", "[signal]")
+{
+    Signal<void(std::vector<int>&)> sig;
+    auto const push = [](int i) {
+        return [i](std::vector<int>& calls) { calls.push_back(i); };
+    };
+    sig.connect(push(0));
+
+    auto back = std::vector<std::function<void(std::vector<int>&)>>{
+        push(1), push(2), push(3)};
+    auto const c_back = sig.connect_range(back);
+    auto const c_front =
+        sig.connect_range(std::vector{push(4), push(5)}, Position::at_front);
+    auto const c_group = sig.connect_range(7, std::vector{push(6), push(7)});
+    sig.connect_range(7, std::vector{push(8)}, Position::at_front);
+    sig.connect_range(3, std::vector<std::function<void(std::vector<int>&)>>{});
+
+    CHECK(c_back.size() == 3);
+    CHECK(c_front.size() == 2);
+    CHECK(sig.num_slots() == 9);
+    CHECK(back.size() == 3);
+    CHECK(bool(back[0]));
+
+    auto calls = std::vector<int>{};
+    sig(calls);
+    CHECK(calls == std::vector<int>{4, 5, 8, 6, 7, 0, 1, 2, 3});
+
+    c_back[1].disconnect();
+    calls.clear();
+    sig(calls);
+    CHECK(calls == std::vector<int>{4, 5, 8, 6, 7, 0, 1, 3});
+
+    sig.disconnect(7);
+    CHECK_FALSE(c_group[0].connected());
+    calls.clear();
+    sig(calls);
+    CHECK(calls == std::vector<int>{4, 5, 0, 1, 3});
+}
+
+TEST_CASE("Signal::disconnect() with a range of Connections", "[signal]")
+{
+    Signal<void()> sig;
+    Signal<void()> other;
+    auto const token = std::make_shared<int>(0);
+    auto connections = std::vector<Connection>{};
+    for (auto i = 0; i < 10; ++i)
+        connections.push_back(sig.connect([token] {}));
+    auto const kept = sig.connect(2, [token] {});
+    auto const foreign = other.connect([] {});
+    CHECK(token.use_count() == 12);
+
+    connections.push_back(foreign);
+    connections.push_back(Connection{});
+    sig.disconnect(connections);
+
+    // Erased right away rather than on the next emission.
+    CHECK(token.use_count() == 2);
+    CHECK(sig.num_slots() == 1);
+    CHECK(kept.connected());
+    CHECK_FALSE(connections[3].connected());
+    CHECK_FALSE(foreign.connected());
+
+    sig.disconnect(std::vector<Connection>{});
+    CHECK(sig.num_slots() == 1);
+    sig.disconnect(2);
+    CHECK(sig.empty());
+}
+
 TEST_CASE("Signal::disconnect_all_slots", "[signal]")
 {
     Signal<char(char, int)> sig;
@@ -764,6 +891,337 @@ class New_combiner {
     int value_ = 0;
 };
 
+// Executor that queues tasks until run() is called on the current thread.
+class Manual_executor {
+   public:
+    void execute(Inplace_function<void()> task)
+    {
+        tasks_.push_back(std::move(task));
+    }
+
+    void run()
+    {
+        for (auto& task : tasks_)
+            task();
+        tasks_.clear();
+    }
+
+   private:
+    std::vector<Inplace_function<void()>> tasks_;
+};
+
+TEST_CASE("Signal::emit_async()", "[signal]")
+{
+    Thread_pool pool{2};
+
+    Signal<int(int)> sig1;
+    auto empty = sig1.emit_async(pool, 1);
+    CHECK(!empty.get().has_value());
+
+    auto caller = std::this_thread::get_id();
+    auto callee = std::thread::id{};
+    sig1.connect([&callee](int i) {
+        callee = std::this_thread::get_id();
+        return i + 1;
+    });
+    CHECK(5 == *sig1.emit_async(pool, 4).get());
+    CHECK(caller != callee);
+
+    sig1.disable();
+    CHECK(!sig1.emit_async(pool, 4).get().has_value());
+
+    // Arguments are copied before emit_async returns.
+    Manual_executor manual;
+    Signal<void(std::string const&)> sig2;
+    auto received = std::string{};
+    sig2.connect([&received](std::string const& s) { received = s; });
+    auto text = std::string{"hello"};
+    auto done = sig2.emit_async(manual, text);
+    text      = "changed";
+    manual.run();
+    done.get();
+    CHECK("hello" == received);
+
+    // The connections are the ones present when emit_async was called, and
+    // the Signal may be gone by the time the task runs.
+    auto count = 0;
+    auto later = std::future<std::optional<int>>{};
+    {
+        Signal<int(int)> sig3;
+        auto c = sig3.connect([&count](int i) { return count += i; });
+        later  = sig3.emit_async(manual, 2);
+        sig3.connect([&count](int i) { return count += i * 100; });
+    }
+    manual.run();
+    CHECK(2 == *later.get());
+    CHECK(2 == count);
+
+    // Exceptions from Slots are stored in the future.
+    Signal<void()> sig4;
+    sig4.connect([] { throw std::runtime_error{"slot"}; });
+    CHECK_THROWS_AS(sig4.emit_async(pool).get(), std::runtime_error);
+
+    // Move-only arguments are moved into the task.
+    Signal<int(std::unique_ptr<int> const&)> sig5;
+    sig5.connect([](std::unique_ptr<int> const& p) { return *p; });
+    CHECK(9 == *sig5.emit_async(pool, std::make_unique<int>(9)).get());
+}
+
+// Combiner collecting every Slot result in call order.
+class Collect_combiner {
+   public:
+    using Result_type = std::vector<int>;
+
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        auto results = Result_type{};
+        for (; first != last; ++first)
+            results.push_back(*first);
+        return results;
+    }
+};
+
+TEST_CASE("Signal::emit_parallel()", "[signal]")
+{
+    Thread_pool pool{3};
+
+    Signal<int(int), Collect_combiner> sig1;
+    CHECK(sig1.emit_parallel(pool, 1).empty());
+
+    // Results are combined in call order whichever Slot finishes first.
+    auto started = std::atomic<int>{0};
+    for (auto i = 0; i < 4; ++i) {
+        sig1.connect(1, [i, &started](int x) {
+            ++started;
+            std::this_thread::sleep_for(std::chrono::milliseconds(4 - i));
+            return x * 10 + i;
+        });
+    }
+    sig1.connect(2, [&started](int x) {
+        // Every Slot of group 1 has returned before group 2 starts.
+        CHECK(5 == ++started);
+        return x * 10 + 4;
+    });
+    sig1.connect([&started](int x) { return ++started, x * 10 + 9; });
+    sig1.connect([&started](int x) { return ++started, x * 10 + 8; },
+                 Position::at_front);
+    auto const blocked = sig1.connect(2, [](int) { return -1; });
+    auto const blocker = Shared_connection_block{blocked};
+    sig1.connect(3, [](int) { return -2; }).disconnect();
+
+    started = -1;
+    CHECK(sig1.emit_parallel(pool, 1) ==
+          std::vector<int>{18, 10, 11, 12, 13, 14, 19});
+
+    sig1.disable();
+    CHECK(sig1.emit_parallel(pool, 1).empty());
+}
+
+// Collects the addresses of the objects the Slots return references to.
+struct Address_collector {
+    using Result_type = std::vector<int const*>;
+
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        auto results = Result_type{};
+        for (; first != last; ++first)
+            results.push_back(&*first);
+        return results;
+    }
+};
+
+TEST_CASE("Signal::emit_parallel() with a reference return type", "[signal]")
+{
+    Thread_pool pool{2};
+    auto values = std::vector<int>{0, 1, 2};
+    Signal<int&(std::size_t), Address_collector> sig;
+    sig.connect(1, [&values](std::size_t i) -> int& { return values[i]; });
+    sig.connect(1, [&values](std::size_t i) -> int& { return values[i + 1]; });
+    sig.connect(2, [&values](std::size_t) -> int& { return values[0]; });
+    CHECK(sig.emit_parallel(pool, std::size_t{1}) ==
+          std::vector<int const*>{&values[1], &values[2], &values[0]});
+}
+
+// Runs tasks inline, counting them, and reports a single thread.
+struct Single_thread_executor {
+    std::size_t posted = 0;
+
+    auto size() const -> std::size_t { return 1; }
+
+    template <typename Task>
+    void execute(Task&& task)
+    {
+        ++posted;
+        task();
+    }
+};
+
+TEST_CASE("Signal::emit_parallel() sizes helpers to the executor", "[signal]")
+{
+    auto executor = Single_thread_executor{};
+    auto calls    = 0;
+    Signal<void()> sig;
+    for (auto i = 0; i < 4; ++i)
+        sig.connect(0, [&calls] { ++calls; });
+    sig.emit_parallel(executor);
+    CHECK(1 == executor.posted);
+    CHECK(4 == calls);
+}
+
+TEST_CASE("Signal::emit_parallel() runs a group concurrently", "[signal]")
+{
+    Thread_pool pool{1};
+    Signal<void()> sig;
+
+    // Each Slot waits for the other, which only returns if they overlap.
+    auto first  = std::promise<void>{};
+    auto second = std::promise<void>{};
+    sig.connect(0, [&] {
+        first.set_value();
+        second.get_future().wait();
+    });
+    sig.connect(0, [&] {
+        second.set_value();
+        first.get_future().wait();
+    });
+    sig.emit_parallel(pool);
+
+    // Exceptions are rethrown once the group is done, later groups are not
+    // called.
+    auto calls = std::atomic<int>{0};
+    Signal<void()> sig2;
+    sig2.connect(0, [&calls] { ++calls; });
+    sig2.connect(0, [] { throw std::runtime_error{"slot"}; });
+    sig2.connect(0, [&calls] { ++calls; });
+    sig2.connect(1, [&calls] { ++calls; });
+    CHECK_THROWS_AS(sig2.emit_parallel(pool), std::runtime_error);
+    CHECK(2 == calls);
+}
+
+TEST_CASE("Signal::emit_batch()", "[signal]")
+{
+    using Args       = std::tuple<int, std::string>;
+    auto const batch = std::vector<Args>{{1, "a"}, {2, "b"}, {3, "c"}};
+
+    Signal<int(int, std::string const&), Collect_combiner> sig1;
+    CHECK(sig1.emit_batch(batch) ==
+          std::vector<std::vector<int>>{{}, {}, {}});
+
+    auto calls = std::vector<std::string>{};
+    sig1.connect([&calls](int i, std::string const& s) {
+        calls.push_back("x" + s);
+        return i;
+    });
+    sig1.connect([&calls](int i, std::string const& s) {
+        calls.push_back("y" + s);
+        return i * 10;
+    });
+    auto const expected =
+        std::vector<std::vector<int>>{{1, 10}, {2, 20}, {3, 30}};
+
+    CHECK(sig1.emit_batch(batch) == expected);
+    CHECK(calls ==
+          std::vector<std::string>{"xa", "ya", "xb", "yb", "xc", "yc"});
+
+    calls.clear();
+    CHECK(sig1.emit_batch(batch, Batch_order::slot_major) == expected);
+    CHECK(calls ==
+          std::vector<std::string>{"xa", "xb", "xc", "ya", "yb", "yc"});
+
+    // Results written through a caller supplied buffer.
+    auto buffer = std::vector<std::vector<int>>(3);
+    auto end    = sig1.emit_batch(batch, std::begin(buffer));
+    CHECK(end == std::end(buffer));
+    CHECK(buffer == expected);
+
+    sig1.disable();
+    CHECK(sig1.emit_batch(batch, Batch_order::slot_major) ==
+          std::vector<std::vector<int>>{{}, {}, {}});
+
+    // A Slot disconnected during the batch is skipped from then on, in both
+    // orders, and Slots connected during the batch wait for the next one.
+    for (auto order : {Batch_order::emission_major, Batch_order::slot_major}) {
+        Signal<void(int)> sig2;
+        auto seen = std::vector<int>{};
+        sig2.connect_extended([&](Connection const& c, int i) {
+            seen.push_back(i);
+            if (i == 2)
+                c.disconnect();
+            sig2.connect([&seen](int) { seen.push_back(-1); });
+        });
+        auto const ints = std::vector<std::tuple<int>>{{1}, {2}, {3}};
+        sig2.emit_batch(ints, order);
+        CHECK(seen == std::vector<int>{1, 2});
+    }
+}
+
+TEST_CASE("Signal::connect() with a Dispatcher", "[signal]")
+{
+    Dispatcher d;
+    Signal<void(std::string const&)> sig;
+    auto received = std::vector<std::string>{};
+    auto c        = sig.connect(
+        [&received](std::string const& s) { received.push_back(s); }, d);
+    CHECK(c.connected());
+    CHECK(1 == sig.num_slots());
+
+    // Arguments are copied when emitted, the Slot runs on run_pending().
+    auto text = std::string{"one"};
+    sig(text);
+    text = "two";
+    sig(text);
+    CHECK(received.empty());
+    CHECK(2 == d.run_pending());
+    CHECK(received == std::vector<std::string>{"one", "two"});
+
+    // Calls still queued when the Connection is disconnected are dropped.
+    sig("three");
+    c.disconnect();
+    sig("four");
+    CHECK(1 == d.run_pending());
+    CHECK(received.size() == 2);
+
+    // Delivery to another thread, in a group, next to a direct Slot.
+    Signal<void(int)> sig2;
+    auto caller = std::this_thread::get_id();
+    auto direct = std::thread::id{};
+    auto queued = std::promise<std::thread::id>{};
+    auto done   = std::atomic<bool>{false};
+    sig2.connect([&direct](int) { direct = std::this_thread::get_id(); });
+    sig2.connect(
+        1, [&queued](int) { queued.set_value(std::this_thread::get_id()); },
+        d);
+    auto target = std::thread{[&d, &done] {
+        while (!done) {
+            if (d.wait_for(std::chrono::milliseconds(1)))
+                d.run_pending();
+        }
+    }};
+    sig2(1);
+    auto const queued_id = queued.get_future().get();
+    done                 = true;
+    target.join();
+    CHECK(caller == direct);
+    CHECK(caller != queued_id);
+
+    // Expired tracked objects are not queued.
+    Signal<void(int)> sig3;
+    auto calls   = 0;
+    auto tracked = std::make_shared<int>(0);
+    auto slot    = Slot<void(int)>{[&calls](int) { ++calls; }};
+    slot.track(tracked);
+    sig3.connect(slot, d);
+    sig3(1);
+    tracked.reset();
+    sig3(1);
+    CHECK(1 == d.run_pending());
+    CHECK(0 == calls);
+}
+
 TEST_CASE("Signal::combiner()", "[signal]")
 {
     Signal<void(int)> sig1;
@@ -793,6 +1251,134 @@ TEST_CASE("Signal::set_combiner()", "[signal]")
     CHECK(3 == sig3.combiner().get_value());
 }
 
+// Combiner with a const call operator and state, that counts its copies.
+class Counting_combiner {
+   public:
+    using Result_type = int;
+
+    explicit Counting_combiner(int offset = 0) : offset_{offset} {}
+
+    Counting_combiner(Counting_combiner const& other) : offset_{other.offset_}
+    {
+        ++copies;
+    }
+
+    auto operator=(Counting_combiner const& other) -> Counting_combiner&
+    {
+        offset_ = other.offset_;
+        ++copies;
+        return *this;
+    }
+
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const -> int
+    {
+        auto sum = offset_;
+        for (; first != last; ++first)
+            sum += *first;
+        return sum;
+    }
+
+    inline static int copies = 0;
+
+   private:
+    int offset_;
+};
+
+TEST_CASE("Signal::operator() uses the published Combiner", "[signal]")
+{
+    Signal<int(int), Counting_combiner> sig;
+    CHECK(0 == sig(1));
+    sig.connect([](int i) { return i; });
+    sig.connect([](int i) { return i * 2; });
+
+    // Stateful Combiners are copied per emission, never under a lock.
+    Counting_combiner::copies = 0;
+    CHECK(9 == sig(3));
+    CHECK(9 == std::as_const(sig)(3));
+    CHECK(2 == Counting_combiner::copies);
+
+    sig.set_combiner(Counting_combiner{100});
+    CHECK(103 == sig(1));
+    CHECK(103 == std::as_const(sig)(1));
+
+    // Emissions already running finish with the Combiner they started with.
+    Signal<int(int), Counting_combiner> sig2;
+    sig2.connect([&sig2](int i) {
+        sig2.set_combiner(Counting_combiner{50});
+        return i;
+    });
+    CHECK(1 == sig2(1));
+    CHECK(51 == sig2(1));
+
+    // A non-const Combiner is copied per emission, the published one is kept.
+    Signal<int(double, char), New_combiner<int>> sig3{New_combiner<int>{7}};
+    sig3(1.0, 'a');
+    CHECK(7 == sig3.combiner().get_value());
+}
+
+// Combiner whose call operators count into mutable state, the non-const one
+// negates its count.
+class Stateful_combiner {
+   public:
+    using Result_type = int;
+
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const -> int
+    {
+        for (; first != last; ++first)
+            count_ += *first;
+        return count_;
+    }
+
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) -> int
+    {
+        return -std::as_const(*this)(first, last);
+    }
+
+   private:
+    mutable int count_ = 0;
+};
+
+TEST_CASE("Signal::operator() does not share Combiner state", "[signal]")
+{
+    Signal<int(int), Stateful_combiner> sig;
+    sig.connect([](int i) { return i; });
+    CHECK(-2 == sig(2));
+    CHECK(-2 == sig(2));
+    CHECK(-3 == std::as_const(sig)(3));
+
+    // Concurrent emissions each start from the published Combiner.
+    auto wrong   = std::atomic<int>{0};
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (auto i = 0; i < 1'000; ++i)
+                wrong += sig(1) != -1;
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    CHECK(0 == wrong);
+}
+
+TEST_CASE("Signal moved from can be connected and emitted", "[signal]")
+{
+    Signal<int(int)> sig1;
+    sig1.connect(1, [](int i) { return i; });
+    sig1.connect([](int i) { return i + 1; }, Position::at_front);
+    auto sig2 = std::move(sig1);
+    CHECK(2 == sig2.num_slots());
+    CHECK(!sig1(1).has_value());
+
+    sig1.connect([](int i) { return i * 10; }, Position::at_front);
+    sig1.connect(2, [](int i) { return i * 20; });
+    CHECK(40 == *sig1(2));
+    CHECK(2 == sig1.num_slots());
+    CHECK(2 == *sig2(2));
+}
+
 TEST_CASE("Signal::swap()", "[signal]")
 {
     using std::swap;
@@ -855,3 +1441,379 @@ TEST_CASE("Signal::get_tracker()", "[signal]")
 
     CHECK(2 == sig.get_tracker().use_count());
 }
+
+TEST_CASE("Signal::operator() skips Slots disconnected mid-emission",
+          "[signal]")
+{
+    Signal<int()> sig;
+    auto later = Connection{};
+    sig.connect([&later] {
+        later.disconnect();
+        return 1;
+    });
+    later = sig.connect([] { return 2; });
+
+    auto const result = sig();
+    REQUIRE(bool(result));
+    CHECK(*result == 1);
+}
+
+TEST_CASE("Signal::operator() calls Slots connected mid-emission next time",
+          "[signal]")
+{
+    Signal<void()> sig;
+    auto calls = std::vector<int>{};
+    auto added = 0;
+    sig.connect([&] {
+        calls.push_back(0);
+        auto const id = ++added;
+        sig.connect([&calls, id] { calls.push_back(id); });
+        sig.connect(-1, [&calls, id] { calls.push_back(-id); });
+    });
+    sig.connect([&calls] { calls.push_back(100); });
+
+    sig();
+    CHECK(calls == std::vector<int>{0, 100});
+
+    calls.clear();
+    sig();
+    CHECK(calls == std::vector<int>{-1, 0, 100, 1});
+    CHECK(sig.num_slots() == 6);
+}
+
+TEST_CASE("Signal::operator() while a Slot replaces every connection",
+          "[signal]")
+{
+    Signal<int()> sig;
+    auto const token = std::make_shared<int>(0);
+    auto calls       = std::vector<int>{};
+    sig.connect([&] {
+        calls.push_back(1);
+        sig.disconnect_all_slots();
+        for (auto i = 0; i < 100; ++i)
+            sig.connect([token, &calls] {
+                calls.push_back(2);
+                return 2;
+            });
+        return 1;
+    });
+    sig.connect([token, &calls] {
+        calls.push_back(3);
+        return 3;
+    });
+    CHECK(token.use_count() == 2);
+
+    // The rest of the emission is skipped, the new Slots wait for the next.
+    auto const result = sig();
+    REQUIRE(bool(result));
+    CHECK(*result == 1);
+    CHECK(calls == std::vector<int>{1});
+
+    // Every snapshot replaced during the emission is gone once it returns.
+    CHECK(token.use_count() == 101);
+    CHECK(sig.num_slots() == 100);
+    CHECK(sig() == 2);
+    CHECK(calls.size() == 101);
+}
+
+TEST_CASE("Signal::operator() reentered by a Slot that connects", "[signal]")
+{
+    Signal<void(int)> sig;
+    auto const token = std::make_shared<int>(0);
+    auto calls       = 0;
+    sig.connect([&](int depth) {
+        ++calls;
+        auto const c = sig.connect([token](int) {});
+        if (depth > 0)
+            sig(depth - 1);
+        c.disconnect();
+    });
+    sig(10);
+    CHECK(calls == 11);
+    CHECK(sig.num_slots() == 1);
+    sig.connect([](int) {});  // Compacts, no snapshot is left holding token.
+    CHECK(token.use_count() == 1);
+}
+
+TEST_CASE("Signal<Null_mutex> Slots connecting and disconnecting mid-emission",
+          "[signal]")
+{
+    Signal<void(), Optional_last_value<void>, int, std::less<int>,
+           std::function<void()>, sig::Null_mutex>
+        sig;
+    auto calls = std::vector<int>{};
+    auto later = Connection{};
+    sig.connect([&] {
+        calls.push_back(1);
+        later.disconnect();
+        sig.connect([&calls] { calls.push_back(3); });
+    });
+    later = sig.connect([&calls] { calls.push_back(2); });
+
+    sig();
+    CHECK(calls == std::vector<int>{1});
+    calls.clear();
+    sig();
+    CHECK(calls == std::vector<int>{1, 3});
+}
+
+TEST_CASE("Signal::operator() concurrent with Slots connecting and "
+          "disconnecting",
+          "[signal]")
+{
+    Signal<void()> sig;
+    auto const token = std::make_shared<int>(0);
+    auto count       = std::atomic<int>{0};
+    sig.connect([&] {
+        ++count;
+        auto const c = sig.connect([token] {});
+        c.disconnect();
+    });
+
+    auto emitters = std::vector<std::thread>{};
+    for (auto t = 0; t < 4; ++t) {
+        emitters.emplace_back([&sig] {
+            for (auto i = 0; i < 1'000; ++i)
+                sig();
+        });
+    }
+    for (auto& t : emitters)
+        t.join();
+
+    CHECK(count == 4 * 1'000);
+    CHECK(sig.num_slots() == 1);
+    sig.connect([] {});
+    CHECK(token.use_count() == 1);
+}
+
+TEST_CASE("Signal::operator() concurrent with connect and disconnect",
+          "[signal]")
+{
+    Signal<void(int)> sig;
+    auto count = std::atomic<int>{0};
+    sig.connect([&count](int i) { count += i; });
+
+    auto emitters = std::vector<std::thread>{};
+    for (auto t = 0; t < 4; ++t) {
+        emitters.emplace_back([&sig] {
+            for (auto i = 0; i < 2'000; ++i)
+                sig(1);
+        });
+    }
+    for (auto i = 0; i < 500; ++i) {
+        auto c = sig.connect([](int) {});
+        if (i % 2 == 0)
+            c.disconnect();
+        if (i % 100 == 0)
+            sig.disconnect(0);
+    }
+    for (auto& t : emitters)
+        t.join();
+
+    CHECK(count == 4 * 2'000);
+    CHECK(sig.num_slots() == 251);
+}
+
+TEST_CASE("Signal reclaims disconnected and expired connections", "[signal]")
+{
+    Signal<void()> sig;
+    auto const token = std::make_shared<int>(0);
+    auto connections = std::vector<Connection>{};
+    for (auto i = 0; i < 10; ++i)
+        connections.push_back(sig.connect([token] {}));
+    CHECK(token.use_count() == 11);
+
+    for (auto i = 0; i < 6; ++i)
+        connections[i].disconnect();
+    CHECK(token.use_count() == 11);  // Not reclaimed until emission.
+    sig();
+    CHECK(token.use_count() == 5);
+    CHECK(sig.num_slots() == 4);
+    CHECK_FALSE(connections[0].connected());
+    CHECK(connections[9].connected());
+
+    auto tracked = std::make_shared<char>('t');
+    sig.connect(Slot<void()>{[token] {}}.track(tracked));
+    CHECK(token.use_count() == 6);
+    tracked.reset();
+    sig.connect([] {});  // Mutations also compact.
+    CHECK(token.use_count() == 5);
+
+    for (auto& c : connections)
+        c.disconnect();
+    sig();
+    CHECK(token.use_count() == 1);
+    CHECK(sig.num_slots() == 1);
+}
+
+TEST_CASE("Signal with Inplace_function Slot_function", "[signal]")
+{
+    using Function = Inplace_function<int(int)>;
+    Signal<int(int), Optional_last_value<int>, int, std::less<int>, Function>
+        sig;
+
+    auto p = std::make_unique<int>(10);
+    sig.connect([p = std::move(p)](int x) { return *p + x; });
+    sig.connect(1, [](int x) { return x * 2; }, Position::at_front);
+    auto const c = sig.connect_extended(
+        [](Connection const& c, int x) { return c.connected() ? x : -1; },
+        Position::at_front);
+
+    auto result = sig(5);
+    REQUIRE(bool(result));
+    CHECK(*result == 15);
+
+    result = sig(6);
+    REQUIRE(bool(result));
+    CHECK(*result == 16);
+    CHECK(sig.num_slots() == 3);
+}
+
+namespace {
+
+// Counts the copies and moves made of it.
+struct Payload {
+    static inline int copies = 0;
+    static inline int moves  = 0;
+
+    Payload() = default;
+    Payload(Payload const& x) : value{x.value} { ++copies; }
+    Payload(Payload&& x) noexcept : value{std::move(x.value)} { ++moves; }
+
+    std::string value = "payload";
+};
+
+}  // namespace
+
+TEST_CASE("Signal::emit_forward moves into the last Slot", "[signal]")
+{
+    auto received = std::vector<std::string>{};
+    auto sig      = Signal<void(Payload)>{};
+    for (auto i = 0; i < 3; ++i)
+        sig.connect([&received](Payload p) { received.push_back(p.value); });
+
+    Payload::copies = 0;
+    sig(Payload{});
+    CHECK(Payload::copies == 3);
+
+    Payload::copies = 0;
+    sig.emit_forward(Payload{});
+    CHECK(Payload::copies == 2);
+    CHECK(received == std::vector<std::string>(6, "payload"));
+
+    // Lvalues are never moved from.
+    auto lvalue     = Payload{};
+    Payload::copies = 0;
+    sig.emit_forward(lvalue);
+    CHECK(Payload::copies == 3);
+    CHECK(lvalue.value == "payload");
+}
+
+TEST_CASE("Signal::emit_forward with a single Slot copies nothing", "[signal]")
+{
+    auto sig         = Signal<std::size_t(std::vector<int>)>{};
+    auto const* data = static_cast<int const*>(nullptr);
+    sig.connect([&data](std::vector<int> v) {
+        data = v.data();
+        return v.size();
+    });
+
+    auto v              = std::vector<int>{1, 2, 3};
+    auto const* const p = v.data();
+    CHECK(sig.emit_forward(std::move(v)) == 3u);
+    CHECK(data == p);
+}
+
+TEST_CASE("Signal::emit_forward passes lvalue reference parameters on",
+          "[signal]")
+{
+    auto sig = Signal<void(std::string&, std::string)>{};
+    sig.connect([](std::string& out, std::string s) { out += s; });
+    sig.connect([](std::string& out, std::string s) { out += s + "!"; });
+
+    auto out = std::string{};
+    sig.emit_forward(out, std::string{"hi"});
+    CHECK(out == "hihi!");
+}
+
+TEST_CASE("Signal::emit_forward calls no Slot after the last", "[signal]")
+{
+    auto calls = std::vector<int>{};
+    auto sig   = Signal<void(std::string)>{};
+    auto block = std::optional<Shared_connection_block>{};
+    sig.connect([&calls, &block](std::string s) {
+        calls.push_back(1);
+        CHECK(s == "text");
+        block.reset();  // Unblocks the second Slot.
+    });
+    block.emplace(sig.connect([&calls](std::string s) {
+        calls.push_back(2);
+        CHECK(s == "text");
+    }));
+
+    sig.emit_forward(std::string{"text"});
+    CHECK(calls == std::vector<int>{1});
+
+    sig.emit_forward(std::string{"text"});
+    CHECK(calls == std::vector<int>{1, 1, 2});
+}
+
+TEST_CASE("Signal::emit_forward finds the last Slot when it starts",
+          "[signal]")
+{
+    auto calls = std::vector<int>{};
+    auto sig   = Signal<void(std::string)>{};
+    auto block = std::optional<Shared_connection_block>{};
+    auto c2    = Connection{};
+    sig.connect([&](std::string s) {
+        calls.push_back(1);
+        CHECK(s == "text");
+        block.reset();
+        c2.disconnect();
+    });
+    c2 = sig.connect([&calls](std::string) { calls.push_back(2); });
+    block.emplace(sig.connect([&calls](std::string) { calls.push_back(3); }));
+
+    // The second Slot is last, disconnecting it leaves nothing to call, the
+    // third was blocked when the emission started.
+    sig.emit_forward(std::string{"text"});
+    CHECK(calls == std::vector<int>{1});
+
+    sig.emit_forward(std::string{"text"});
+    CHECK(calls == std::vector<int>{1, 1, 3});
+}
+
+TEST_CASE("Signal with a move only parameter", "[signal]")
+{
+    auto received = std::unique_ptr<int>{};
+    auto sig      = Signal<int(std::unique_ptr<int>)>{};
+    sig.connect([&received](std::unique_ptr<int> p) {
+        received = std::move(p);
+        return *received;
+    });
+    CHECK(sig(std::make_unique<int>(4)) == 4);
+    CHECK(*received == 4);
+    CHECK(sig.emit_forward(std::make_unique<int>(5)) == 5);
+    CHECK(*received == 5);
+
+    auto calls   = 0;
+    auto const c = sig.connect([&calls](std::unique_ptr<int>) {
+        ++calls;
+        return 0;
+    });
+    CHECK_THROWS_AS(sig(std::make_unique<int>(6)), Move_only_arguments);
+    CHECK(*received == 5);
+    CHECK(calls == 0);
+
+    auto const block = Shared_connection_block{c};
+    CHECK(sig(std::make_unique<int>(7)) == 7);
+    CHECK(*received == 7);
+
+    // Checked before the Combiner runs, even one that would stop early.
+    auto first = Signal<int(std::unique_ptr<int>), Optional_first_value<int>>{};
+    first.connect([](std::unique_ptr<int> p) { return *p; });
+    CHECK(*first(std::make_unique<int>(8)) == 8);
+    first.connect([&calls](std::unique_ptr<int>) { return ++calls; });
+    CHECK_THROWS_AS(first(std::make_unique<int>(9)), Move_only_arguments);
+    CHECK(calls == 0);
+}
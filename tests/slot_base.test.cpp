@@ -51,3 +51,29 @@ TEST_CASE("Slot_base::lock()", "[slot_base]")
 
     CHECK(s.expired());
 }
+
+TEST_CASE("Slot_base::pin()", "[slot_base]")
+{
+    Slot<void(int)> s = {[](int) { return; }};
+    CHECK(bool(s.pin()));
+
+    auto tracked = std::vector<std::shared_ptr<int>>{};
+    for (auto i = 0; i < 6; ++i) {
+        tracked.push_back(std::make_shared<int>(i));
+        s.track(tracked.back());
+    }
+    {
+        auto const pinned = s.pin();
+        CHECK(bool(pinned));
+        for (auto const& p : tracked)
+            CHECK(p.use_count() == 2);
+    }
+    for (auto const& p : tracked)
+        CHECK(p.use_count() == 1);
+
+    tracked[5].reset();
+    auto const pinned = s.pin();
+    CHECK_FALSE(bool(pinned));
+    for (auto i = 0; i < 5; ++i)
+        CHECK(tracked[i].use_count() == 1);
+}
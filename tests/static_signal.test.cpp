@@ -0,0 +1,145 @@
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <signals/optional_last_value.hpp>
+#include <signals/static_signal.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Basic_static_signal;
+using sig::make_static_signal;
+using sig::Optional_last_value;
+using sig::Static_signal;
+
+namespace {
+
+struct Twice {
+    auto operator()(int i) const -> int { return i * 2; }
+};
+
+struct Plus_one {
+    auto operator()(int i) const -> int { return i + 1; }
+};
+
+// Counts its own calls, callable only as non-const.
+struct Counter {
+    auto operator()(int) -> int { return ++count; }
+    int count = 0;
+};
+
+// Collects every Slot result in call order.
+class Collect {
+   public:
+    using Result_type = std::vector<int>;
+
+    template <typename InputIterator>
+    auto operator()(InputIterator first, InputIterator last) const
+        -> Result_type
+    {
+        auto results = Result_type{};
+        for (; first != last; ++first)
+            results.push_back(*first);
+        return results;
+    }
+};
+
+// Neither default constructible nor assignable.
+struct Fixed {
+    explicit Fixed(int v) : value{v} {}
+    int const value;
+};
+
+}  // namespace
+
+TEST_CASE("Static_signal::Static_signal()", "[static_signal]")
+{
+    Static_signal<int(int), Twice, Plus_one> sig1;
+    CHECK(2 == sig1.num_slots());
+    CHECK(1 == sig1.arity);
+    CHECK(std::is_same_v<std::optional<int>, decltype(sig1)::Result_type>);
+
+    Static_signal<void(int)> sig2;
+    CHECK(0 == sig2.num_slots());
+
+    auto sig3 = Static_signal<int(int), Counter>{Counter{5}};
+    CHECK(5 == sig3.slot<0>().count);
+}
+
+TEST_CASE("Static_signal::operator()", "[static_signal]")
+{
+    Static_signal<int(int), Twice, Plus_one> sig1;
+    CHECK(4 == *sig1(3));
+
+    Static_signal<int(int)> sig2;
+    CHECK(!sig2(3).has_value());
+
+    auto total = 0;
+    auto sig3  = make_static_signal<void(int)>([&total](int i) { total += i; },
+                                              [&total](int i) { total *= i; });
+    sig3(3);
+    CHECK(9 == total);
+
+    // Non-const Slots are called as non-const.
+    Static_signal<int(int), Counter, Counter> sig4;
+    CHECK(1 == *sig4(0));
+    CHECK(2 == *sig4(0));
+    CHECK(2 == sig4.slot<0>().count);
+
+    // Arguments are passed by reference to every Slot.
+    auto sig5 = make_static_signal<void(std::string&)>(
+        [](std::string& s) { s += "a"; }, [](std::string& s) { s += "b"; });
+    auto text = std::string{};
+    sig5(text);
+    CHECK("ab" == text);
+
+    auto const sig6 = make_static_signal<int(int)>(Twice{}, Plus_one{});
+    CHECK(6 == *sig6(5));
+}
+
+TEST_CASE("Static_signal with a result that cannot be assigned",
+          "[static_signal]")
+{
+    static_assert(!std::is_default_constructible_v<Fixed>);
+    static_assert(!std::is_copy_assignable_v<Fixed>);
+
+    auto calls      = 0;
+    auto const sig1 = make_static_signal<Fixed(int)>(
+        [&calls](int i) {
+            ++calls;
+            return Fixed{i};
+        },
+        [&calls](int i) {
+            ++calls;
+            return Fixed{i * 2};
+        },
+        [&calls](int i) {
+            ++calls;
+            return Fixed{i * 3};
+        });
+    auto const result = sig1(2);
+    REQUIRE(result.has_value());
+    CHECK(6 == result->value);
+    CHECK(3 == calls);
+
+    Static_signal<Fixed(int)> sig2;
+    CHECK_FALSE(sig2(2).has_value());
+}
+
+TEST_CASE("Static_signal with a Combiner", "[static_signal]")
+{
+    Basic_static_signal<int(int), Collect, Twice, Plus_one, Twice> sig1;
+    CHECK(sig1(5) == std::vector<int>{10, 6, 10});
+
+    Basic_static_signal<int(int), Collect> sig2;
+    CHECK(sig2(5).empty());
+
+    Basic_static_signal<void(int), Optional_last_value<void>, Counter> sig3;
+    sig3(1);
+    CHECK(1 == sig3.slot<0>().count);
+
+    auto counted = Basic_static_signal<int(int), Collect, Counter, Twice>{
+        Counter{1}, Twice{}, Collect{}};
+    CHECK(counted(4) == std::vector<int>{2, 8});
+}
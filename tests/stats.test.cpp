@@ -0,0 +1,191 @@
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <signals/batch_order.hpp>
+#include <signals/connection.hpp>
+#include <signals/optional_last_value.hpp>
+#include <signals/shared_connection_block.hpp>
+#include <signals/signal.hpp>
+#include <signals/slot.hpp>
+#include <signals/stats.hpp>
+#include <signals/thread_pool.hpp>
+#include <signals/threading.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Batch_order;
+using sig::Latency_histogram;
+using sig::Null_mutex;
+using sig::Shared_connection_block;
+using sig::Signal;
+using sig::Slot;
+using sig::Thread_pool;
+
+TEST_CASE("Latency_histogram", "[stats]")
+{
+    auto h = Latency_histogram{};
+    CHECK(h.count() == 0);
+    CHECK(h.quantile(0.5) == std::chrono::nanoseconds{0});
+
+    h.buckets[3]  = 6;  // [8, 16) ns
+    h.buckets[10] = 3;  // [1024, 2048) ns
+    h.buckets[20] = 1;
+    CHECK(h.count() == 10);
+    CHECK(h.quantile(0.0) == std::chrono::nanoseconds{16});
+    CHECK(h.quantile(0.5) == std::chrono::nanoseconds{16});
+    CHECK(h.quantile(0.8) == std::chrono::nanoseconds{2048});
+    CHECK(h.quantile(1.0) == std::chrono::nanoseconds{2 << 20});
+
+    h += h;
+    CHECK(h.count() == 20);
+    CHECK(h.buckets[3] == 12);
+}
+
+TEST_CASE("Signal::stats() counts emissions and Slot calls", "[stats]")
+{
+    Signal<int(int)> sig;
+    CHECK(sig.stats().emissions == 0);
+    CHECK(sig.stats().slots.empty());
+
+    auto const fast = sig.connect([](int x) { return x; });
+    auto const slow = sig.connect([](int x) {
+        std::this_thread::sleep_for(std::chrono::microseconds{100});
+        return x * 2;
+    });
+    sig.connect_extended([](sig::Connection const&, int x) { return x; },
+                         sig::Position::at_front);
+    sig(1);
+    sig(2);
+
+    auto stats = sig.stats();
+    CHECK(stats.emissions == 2);
+    CHECK(stats.invoked == 6);
+    REQUIRE(stats.slots.size() == 3);
+    CHECK(stats.slots[1].connection == fast.handle());
+    CHECK(stats.slots[2].connection == slow.handle());
+    CHECK(stats.slots[1].invoked == 2);
+    CHECK(stats.slots[1].latency.count() == 2);
+    CHECK(stats.slots[2].latency.quantile(0.5) >=
+          std::chrono::microseconds{100});
+    CHECK(stats.slots[1].latency.quantile(1.0) <
+          stats.slots[2].latency.quantile(0.0));
+
+    sig.disable();
+    sig(3);
+    CHECK(sig.stats().emissions == 2);
+}
+
+TEST_CASE("Signal::stats() counts skipped Slots", "[stats]")
+{
+    Signal<void()> sig;
+    auto const blocked = sig.connect([] {});
+    auto const gone    = sig.connect([] {});
+    auto tracked       = std::make_shared<int>(0);
+    sig.connect(Slot<void()>{[] {}}.track(tracked));
+    sig.connect([] {});
+
+    {
+        auto const block = Shared_connection_block{blocked};
+        sig();
+    }
+    gone.disconnect();
+    tracked.reset();
+    sig();
+
+    auto stats = sig.stats();
+    CHECK(stats.emissions == 2);
+    CHECK(stats.invoked == 5);
+    CHECK(stats.skipped_blocked == 1);
+    CHECK(stats.skipped_disconnected == 1);
+    CHECK(stats.skipped_expired == 1);
+    REQUIRE(stats.slots.size() == 2);
+    CHECK(stats.slots[0].connection == blocked.handle());
+    CHECK(stats.slots[0].skipped_blocked == 1);
+    CHECK(stats.slots[0].invoked == 1);
+
+    // Totals survive the connections being erased.
+    sig.disconnect_all_slots();
+    stats = sig.stats();
+    CHECK(stats.slots.empty());
+    CHECK(stats.invoked == 5);
+    CHECK(stats.skipped_disconnected == 1);
+
+    sig.reset_stats();
+    stats = sig.stats();
+    CHECK(stats.emissions == 0);
+    CHECK(stats.invoked == 0);
+    CHECK(stats.skipped_expired == 0);
+}
+
+TEST_CASE("Signal::stats() covers every emission path", "[stats]")
+{
+    Signal<int(int)> sig;
+    sig.connect([](int x) { return x; });
+    sig.connect(1, [](int x) { return x + 1; });
+    sig.connect(1, [](int x) { return x + 2; });
+
+    auto const batch = std::vector<std::tuple<int>>{{1}, {2}, {3}};
+    sig.emit_batch(batch);
+    sig.emit_batch(batch, Batch_order::slot_major);
+    CHECK(sig.stats().emissions == 6);
+    CHECK(sig.stats().invoked == 18);
+
+    auto pool = Thread_pool{2};
+    sig.emit_parallel(pool, 1);
+    sig.emit_async(pool, 1).get();
+    auto const stats = sig.stats();
+    CHECK(stats.emissions == 8);
+    CHECK(stats.invoked == 24);
+    for (auto const& slot : stats.slots)
+        CHECK(slot.latency.count() == 8);
+}
+
+TEST_CASE("Signal::stats() with a Single_threaded Signal", "[stats]")
+{
+    Signal<void(), sig::Optional_last_value<void>, int, std::less<int>,
+           std::function<void()>, Null_mutex>
+        sig;
+    auto const c = sig.connect([] {});
+    sig();
+    c.disconnect();
+    sig();
+    auto const stats = sig.stats();
+    CHECK(stats.emissions == 2);
+    CHECK(stats.invoked == 1);
+    CHECK(stats.skipped_disconnected == 1);
+}
+
+TEST_CASE("Signal::stats() of copies and moves", "[stats]")
+{
+    Signal<void()> sig;
+    sig.connect([] {});
+    sig();
+    sig();
+
+    // Copies share the statistics of each Slot, not the Signal totals.
+    auto copy = sig;
+    CHECK(copy.stats().emissions == 0);
+    REQUIRE(copy.stats().slots.size() == 1);
+    CHECK(copy.stats().slots[0].invoked == 2);
+    copy();
+    CHECK(sig.stats().emissions == 2);
+    CHECK(sig.stats().slots[0].invoked == 3);
+    copy.reset_stats();
+    CHECK(sig.stats().slots[0].invoked == 0);
+
+    // Moves carry every counter over.
+    sig();
+    auto moved = std::move(sig);
+    CHECK(moved.stats().emissions == 3);
+    CHECK(moved.stats().slots[0].invoked == 1);
+    CHECK(sig.stats().emissions == 0);
+
+    copy = moved;
+    CHECK(copy.stats().emissions == 0);
+    copy = std::move(moved);
+    CHECK(copy.stats().emissions == 3);
+}
@@ -0,0 +1,72 @@
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <signals/thread_pool.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Thread_pool;
+
+TEST_CASE("Thread_pool::Thread_pool()", "[thread_pool]")
+{
+    Thread_pool pool1{3};
+    CHECK(3 == pool1.size());
+
+    Thread_pool pool2{0};
+    CHECK(1 == pool2.size());
+
+    Thread_pool pool3;
+    CHECK(pool3.size() >= 1);
+}
+
+TEST_CASE("Thread_pool::execute()", "[thread_pool]")
+{
+    auto count = std::atomic<int>{0};
+    {
+        Thread_pool pool{4};
+        for (auto i = 0; i < 100; ++i)
+            pool.execute([&count] { ++count; });
+    }
+    // Destruction runs every queued task before joining.
+    CHECK(100 == count);
+
+    Thread_pool pool{2};
+    auto ran_on = std::promise<std::thread::id>{};
+    auto id     = ran_on.get_future();
+    pool.execute([&ran_on] { ran_on.set_value(std::this_thread::get_id()); });
+    CHECK(std::this_thread::get_id() != id.get());
+
+    // Move-only tasks.
+    auto value  = std::make_unique<int>(7);
+    auto result = std::promise<int>{};
+    auto got    = result.get_future();
+    pool.execute([v = std::move(value), r = std::move(result)]() mutable {
+        r.set_value(*v);
+    });
+    CHECK(7 == got.get());
+}
+
+TEST_CASE("Thread_pool runs tasks concurrently", "[thread_pool]")
+{
+    Thread_pool pool{2};
+    auto first  = std::promise<void>{};
+    auto second = std::promise<void>{};
+    auto done   = std::promise<void>{};
+
+    // Each task waits on the other, which only finishes with two workers.
+    pool.execute([&] {
+        first.set_value();
+        second.get_future().wait();
+    });
+    pool.execute([&] {
+        first.get_future().wait();
+        second.set_value();
+        done.set_value();
+    });
+    done.get_future().wait();
+}
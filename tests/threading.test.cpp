@@ -0,0 +1,122 @@
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+#include <signals/connection.hpp>
+#include <signals/detail/connection_impl.hpp>
+#include <signals/detail/connection_table.hpp>
+#include <signals/optional_last_value.hpp>
+#include <signals/position.hpp>
+#include <signals/shared_connection_block.hpp>
+#include <signals/signal.hpp>
+#include <signals/threading.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Connection;
+using sig::Connection_impl;
+using sig::Multi_threaded;
+using sig::Null_mutex;
+using sig::Optional_last_value;
+using sig::Position;
+using sig::Shared_connection_block;
+using sig::Signal;
+using sig::Single_threaded;
+using sig::Threading_policy;
+
+template <typename Signature>
+using Single_threaded_signal =
+    Signal<Signature,
+           Optional_last_value<
+               typename sig::Function_type_splitter<Signature>::Return_t>,
+           int,
+           std::less<int>,
+           std::function<Signature>,
+           Null_mutex>;
+
+TEST_CASE("Threading_policy", "[threading]")
+{
+    CHECK(std::is_same_v<Threading_policy<std::mutex>::type, Multi_threaded>);
+    CHECK(std::is_same_v<Threading_policy<Null_mutex>::type, Single_threaded>);
+    CHECK(sizeof(Connection_impl<void(), std::function<void()>,
+                                 Single_threaded>) <=
+          sizeof(Connection_impl<void(), std::function<void()>,
+                                 Multi_threaded>));
+    CHECK(std::is_same_v<sig::Connection_table<Single_threaded>::Word,
+                         sig::Unsynchronized<std::uint64_t>>);
+    CHECK(std::is_same_v<Single_threaded::Mutex, Null_mutex>);
+}
+
+TEST_CASE("Single threaded Signal", "[threading]")
+{
+    Single_threaded_signal<int(int)> sig;
+    auto c1 = sig.connect([](int i) { return i; });
+    auto c2 = sig.connect(1, [](int i) { return i * 2; }, Position::at_front);
+    CHECK(sig.num_slots() == 2);
+
+    auto result = sig(3);
+    REQUIRE(bool(result));
+    CHECK(*result == 3);
+
+    {
+        auto const block = Shared_connection_block{c1};
+        CHECK(c1.blocked());
+        result = sig(3);
+        REQUIRE(bool(result));
+        CHECK(*result == 6);
+    }
+    CHECK_FALSE(c1.blocked());
+
+    c1.disconnect();
+    CHECK_FALSE(c1.connected());
+    CHECK(c2.connected());
+    CHECK(sig.num_slots() == 1);
+
+    sig.disable();
+    CHECK_FALSE(bool(sig(3)));
+    sig.enable();
+    CHECK(*sig(3) == 6);
+
+    auto copy = sig;
+    CHECK(*copy(4) == 8);
+    auto moved = std::move(copy);
+    CHECK(*moved(5) == 10);
+}
+
+TEST_CASE("Single threaded Signal extended Slot", "[threading]")
+{
+    Single_threaded_signal<void()> sig;
+    auto count = 0;
+    sig.connect_extended([&count](Connection const& c) {
+        ++count;
+        c.disconnect();
+    });
+    sig();
+    sig();
+    CHECK(count == 1);
+    CHECK(sig.empty());
+}
+
+TEST_CASE("Single threaded Shared_connection_block outliving its Signal",
+          "[threading]")
+{
+    auto block = std::optional<Shared_connection_block>{};
+    {
+        Single_threaded_signal<void()> sig;
+        auto const c = sig.connect([] {});
+        block.emplace(c);
+        CHECK(c.blocked());
+    }
+    CHECK_FALSE(block->blocking());
+
+    // The released entry is reused, the stale block must leave it alone.
+    Single_threaded_signal<void()> sig;
+    auto const c = sig.connect([] {});
+    block->block();
+    CHECK_FALSE(c.blocked());
+    block.reset();
+    CHECK_FALSE(c.blocked());
+    CHECK(c.connected());
+}
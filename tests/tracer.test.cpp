@@ -0,0 +1,347 @@
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <signals/connection.hpp>
+#include <signals/signal.hpp>
+#include <signals/tracer.hpp>
+
+#include <catch2/catch.hpp>
+
+using sig::Signal;
+using sig::Trace_scope;
+using sig::Tracer;
+
+namespace {
+
+auto trace_json() -> std::string
+{
+    auto out = std::ostringstream{};
+    Tracer::instance().write_json(out);
+    return out.str();
+}
+
+// Number of non-overlapping occurrences of \p pattern in \p text.
+auto count(std::string const& text, std::string const& pattern) -> std::size_t
+{
+    auto n   = std::size_t{0};
+    auto pos = text.find(pattern);
+    while (pos != std::string::npos) {
+        ++n;
+        pos = text.find(pattern, pos + pattern.size());
+    }
+    return n;
+}
+
+// Event phases in the order they appear in \p json.
+auto phases(std::string const& json) -> std::string
+{
+    auto result    = std::string{};
+    auto const key = std::string{"\"ph\":\""};
+    for (auto pos = json.find(key); pos != std::string::npos;
+         pos = json.find(key, pos + 1)) {
+        result += json[pos + key.size()];
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Tracer records nothing while inactive", "[tracer]")
+{
+    auto& tracer = Tracer::instance();
+    tracer.start();
+    tracer.stop();
+    CHECK(!tracer.active());
+
+    auto s = Signal<void(int)>{};
+    s.connect([](int) {});
+    s(1);
+    { auto const scope = Trace_scope{"idle", "test"}; }
+
+    CHECK(trace_json() ==
+          "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n");
+    CHECK(tracer.dropped() == 0);
+}
+
+TEST_CASE("Tracer records emissions and Slot calls", "[tracer]")
+{
+    auto& tracer = Tracer::instance();
+
+    auto s = Signal<int(int)>{};
+    s.set_name("frame");
+    CHECK(s.name() == "frame");
+    auto const c = s.connect([](int x) { return x + 1; });
+    s.connect([](int x) { return x * 2; });
+    s.set_slot_label(c, "increment");
+
+    tracer.start();
+    CHECK(tracer.active());
+    CHECK(*s(3) == 6);
+    tracer.stop();
+
+    auto const json = trace_json();
+    CHECK(json.find("{\"traceEvents\":[") == 0);
+    CHECK(count(json, "\"name\":\"frame\",\"cat\":\"emission\"") == 2);
+    CHECK(count(json, "\"name\":\"increment\",\"cat\":\"slot\"") == 2);
+    CHECK(count(json, "\"name\":\"Slot\",\"cat\":\"slot\"") == 2);
+    CHECK(count(json, "\"pid\":1,\"tid\":") == 6);
+    CHECK(phases(json) == "BBEBEE");
+    CHECK(json.find("\"name\":\"increment\"") <
+          json.find("\"name\":\"Slot\""));
+
+    // Events after stop() are not recorded.
+    s(3);
+    CHECK(trace_json() == json);
+}
+
+TEST_CASE("Tracer records batch emissions", "[tracer]")
+{
+    auto s = Signal<void(int)>{};
+    s.set_name("batch");
+    s.connect([](int) {});
+    s.connect([](int) {});
+    auto const batch = std::vector<std::tuple<int>>{{1}, {2}};
+
+    Tracer::instance().start();
+    s.emit_batch(batch);
+    Tracer::instance().stop();
+    auto json = trace_json();
+    CHECK(count(json, "\"name\":\"batch\",\"cat\":\"emission\"") == 4);
+    CHECK(phases(json) == "BBEBEEBBEBEE");
+
+    Tracer::instance().start();
+    s.emit_batch(batch, sig::Batch_order::slot_major);
+    Tracer::instance().stop();
+    json = trace_json();
+    CHECK(count(json, "\"name\":\"batch\",\"cat\":\"batch\"") == 2);
+    CHECK(count(json, "\"cat\":\"slot\"") == 8);
+    CHECK(phases(json) == "BBEBEBEBEE");
+}
+
+TEST_CASE("Tracer names default to Signal and Slot", "[tracer]")
+{
+    auto s = Signal<void()>{};
+    CHECK(s.name() == "Signal");
+    s.connect([] {});
+
+    Tracer::instance().start();
+    s();
+    Tracer::instance().stop();
+
+    auto const json = trace_json();
+    CHECK(count(json, "\"name\":\"Signal\",\"cat\":\"emission\"") == 2);
+    CHECK(count(json, "\"name\":\"Slot\",\"cat\":\"slot\"") == 2);
+}
+
+TEST_CASE("Tracer traces nested emissions", "[tracer]")
+{
+    auto inner = Signal<void()>{};
+    inner.set_name("inner");
+    inner.connect([] {});
+    auto outer = Signal<void()>{};
+    outer.set_name("outer");
+    outer.connect([&inner] { inner(); });
+
+    Tracer::instance().start();
+    outer();
+    Tracer::instance().stop();
+
+    auto const json = trace_json();
+    CHECK(phases(json) == "BBBBEEEE");
+    CHECK(json.find("\"outer\"") < json.find("\"inner\""));
+}
+
+TEST_CASE("Tracer stopped while scopes are open", "[tracer]")
+{
+    auto& tracer = Tracer::instance();
+    auto s       = Signal<void()>{};
+    s.set_name("stopping");
+    s.connect([&tracer] { tracer.stop(); });
+    s.connect([] {});
+
+    // The emission and the first Slot began before stop() and still end, the
+    // second Slot is not traced.
+    tracer.start();
+    s();
+    CHECK(!tracer.active());
+    CHECK(phases(trace_json()) == "BBEE");
+
+    // A scope begun before a restart does not end in the new trace.
+    tracer.start();
+    {
+        auto const scope = Trace_scope{"restarted", "test"};
+        tracer.start();
+    }
+    tracer.stop();
+    CHECK(phases(trace_json()).empty());
+}
+
+TEST_CASE("Tracer Signal copies take the name", "[tracer]")
+{
+    auto s = Signal<void()>{};
+    s.set_name("original");
+    auto copy = s;
+    CHECK(copy.name() == "original");
+
+    auto moved = std::move(copy);
+    CHECK(moved.name() == "original");
+
+    auto other = Signal<void()>{};
+    other      = moved;
+    CHECK(other.name() == "original");
+}
+
+TEST_CASE("Tracer ignores labels of foreign connections", "[tracer]")
+{
+    auto s     = Signal<void()>{};
+    auto other = Signal<void()>{};
+    s.connect([] {});
+    auto const c = other.connect([] {});
+    s.set_slot_label(c, "foreign");
+    s.set_slot_label(sig::Connection{}, "none");
+
+    Tracer::instance().start();
+    s();
+    other();
+    Tracer::instance().stop();
+
+    auto const json = trace_json();
+    CHECK(json.find("foreign") == std::string::npos);
+    CHECK(count(json, "\"name\":\"Slot\"") == 4);
+}
+
+TEST_CASE("Tracer drops events once a buffer is full", "[tracer]")
+{
+    auto s = Signal<void()>{};
+    s.connect([] {});
+
+    auto& tracer = Tracer::instance();
+    tracer.start(5);
+    s();
+    s();
+    tracer.stop();
+
+    CHECK(count(trace_json(), "\"ph\":") == 5);
+    CHECK(tracer.dropped() == 3);
+
+    tracer.start();
+    CHECK(tracer.dropped() == 0);
+    CHECK(count(trace_json(), "\"ph\":") == 0);
+    tracer.stop();
+}
+
+TEST_CASE("Tracer gives each thread its own buffer", "[tracer]")
+{
+    auto s = Signal<void()>{};
+    s.connect([] {});
+
+    auto& tracer = Tracer::instance();
+    tracer.start();
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0; i < 4; ++i) {
+        threads.emplace_back([&s] {
+            for (auto j = 0; j < 100; ++j) {
+                s();
+                if (j == 50)
+                    trace_json();  // Concurrent reads see a prefix.
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    tracer.stop();
+
+    auto const json = trace_json();
+    CHECK(count(json, "\"ph\":\"B\"") == 800);
+    CHECK(count(json, "\"ph\":\"E\"") == 800);
+
+    auto tids      = std::set<std::string>{};
+    auto const key = std::string{"\"tid\":"};
+    for (auto pos = json.find(key); pos != std::string::npos;
+         pos = json.find(key, pos + 1)) {
+        auto const begin = pos + key.size();
+        tids.insert(json.substr(begin, json.find('}', begin) - begin));
+    }
+    CHECK(tids.size() == 4);
+}
+
+TEST_CASE("Tracer restarted while threads record", "[tracer]")
+{
+    auto s = Signal<void()>{};
+    s.connect([] {});
+
+    auto& tracer = Tracer::instance();
+    tracer.start();
+    auto done    = std::atomic<bool>{false};
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0; i < 4; ++i) {
+        threads.emplace_back([&s, &done] {
+            while (!done)
+                s();
+        });
+    }
+    for (auto i = 0; i < 100; ++i)
+        tracer.start(1'024);
+    done = true;
+    for (auto& t : threads)
+        t.join();
+    tracer.stop();
+
+    // Every timestamp is a non-negative number of microseconds.
+    auto const json = trace_json();
+    auto const key  = std::string{"\"ts\":"};
+    auto malformed  = 0;
+    for (auto pos = json.find(key); pos != std::string::npos;
+         pos = json.find(key, pos + 1)) {
+        auto const begin = pos + key.size();
+        auto const ts    = json.substr(begin, json.find(',', begin) - begin);
+        auto const dot   = ts.find('.');
+        if (dot == std::string::npos || dot == 0 || ts.size() - dot != 4 ||
+            ts.find_first_not_of("0123456789.") != std::string::npos) {
+            ++malformed;
+        }
+    }
+    CHECK(malformed == 0);
+}
+
+TEST_CASE("Tracer escapes names", "[tracer]")
+{
+    auto& tracer     = Tracer::instance();
+    auto const* name = tracer.intern("say \"hi\"\\\n");
+    CHECK(tracer.intern("say \"hi\"\\\n") == name);
+
+    tracer.start();
+    { auto const scope = Trace_scope{name, "test"}; }
+    tracer.stop();
+
+    CHECK(trace_json().find("\"name\":\"say \\\"hi\\\"\\\\\\u000a\"") !=
+          std::string::npos);
+}
+
+TEST_CASE("Tracer saves to a file", "[tracer]")
+{
+    auto& tracer = Tracer::instance();
+    tracer.start();
+    { auto const scope = Trace_scope{"saved", "test"}; }
+    tracer.stop();
+
+    auto const path = std::string{"signals_tracer_test.json"};
+    tracer.save(path);
+    auto file          = std::ifstream{path};
+    auto const content = std::string{std::istreambuf_iterator<char>{file},
+                                     std::istreambuf_iterator<char>{}};
+    CHECK(content == trace_json());
+
+    CHECK_THROWS_AS(tracer.save("no/such/directory/trace.json"),
+                    std::runtime_error);
+}